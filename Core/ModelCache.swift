@@ -1,57 +1,107 @@
 import Foundation
 import RealityKit
 
-/// Actor-based cache for loaded ModelEntity instances.
-/// Stores cloned copies on request to keep callers isolated from shared instances.
-actor ModelCache {
+/// Cache for loaded ModelEntity instances, bounded by mesh + texture bytes.
+/// Callers always get a clone so the cached original is never mutated by a scene.
+/// Policy (O(1) LRU, shared loads) lives in `AsyncLRUCache`. Entities are RealityKit main-actor
+/// types, so they're loaded, measured and cloned on the main actor; the cache actor only ever
+/// sees the byte count.
+final class ModelCache: Sendable {
     static let shared = ModelCache()
 
-    private var cache: [String: ModelCacheEntry] = [:]
-    private var order: [String] = [] // LRU order: most recent at end
-    private let maxEntries: Int
+    let cache: AsyncLRUCache<String, CachedModel>
 
-    init(maxEntries: Int = 8) {
-        self.maxEntries = maxEntries
+    init(costLimit: Int = 150 * 1024 * 1024, maxEntries: Int = 8) {
+        cache = AsyncLRUCache(
+            costLimit: costLimit,
+            countLimit: maxEntries,
+            cost: { $0.bytes },
+            load: { name in
+                try await TelemetryRecorder.shared.measure("model_load", source: name) {
+                    try await ModelCache.loadFromBundle(named: name)
+                }
+            }
+        )
     }
 
-    func getClone(for key: String) -> ModelEntity? {
-        guard let entry = cache[key] else { return nil }
-        // update LRU
-        if let idx = order.firstIndex(of: key) {
-            order.remove(at: idx)
-            order.append(key)
-        }
-        return entry.entity.clone(recursive: true)
+    /// Clone of the cached entity, or nil without loading anything.
+    @MainActor
+    func getClone(for key: String) async -> ModelEntity? {
+        await cache.cachedValue(for: key)?.entity.clone(recursive: true)
     }
 
-    func set(_ entity: ModelEntity, for key: String) {
-        let entry = ModelCacheEntry(entity: entity)
-        cache[key] = entry
-        // update LRU
-        if let idx = order.firstIndex(of: key) {
-            order.remove(at: idx)
-        }
-        order.append(key)
-        // evict if needed
-        evictIfNeeded()
+    /// Clone of the bundled model `name`, loading and caching it on first use.
+    @MainActor
+    func clone(named name: String) async -> ModelEntity? {
+        await cache.value(for: name)?.entity.clone(recursive: true)
     }
 
-    private func evictIfNeeded() {
-        while order.count > maxEntries {
-            let evictKey = order.removeFirst()
-            cache.removeValue(forKey: evictKey)
-        }
+    @MainActor
+    func set(_ entity: ModelEntity, for key: String) async {
+        await cache.insert(CachedModel(entity: entity), for: key)
+    }
+
+    func clear() async {
+        await cache.removeAll()
     }
 
-    func clear() {
-        cache.removeAll()
-        order.removeAll()
+    /// Bundled USDZ first, then anything `Entity.loadAsync(named:)` can find.
+    @MainActor
+    private static func loadFromBundle(named name: String) async throws -> CachedModel? {
+        let entity: ModelEntity?
+        if let url = Bundle.main.url(forResource: name, withExtension: "usdz") {
+            entity = try await ModelEntity.loadModelAsync(contentsOf: url).value
+        } else {
+            entity = try await Entity.loadAsync(named: name).value as? ModelEntity
+        }
+        return entity.map { CachedModel(entity: $0) }
     }
 }
 
-private final class ModelCacheEntry {
+/// A cached entity and its cost, measured once on the main actor when it was cached.
+/// The entity itself is only touched on the main actor (cloning); the cache actor reads `bytes`.
+final class CachedModel: @unchecked Sendable {
     let entity: ModelEntity
+    let bytes: Int
+
+    @MainActor
     init(entity: ModelEntity) {
         self.entity = entity
+        self.bytes = ModelCost.bytes(of: entity)
+    }
+}
+
+/// Approximate resident size of an entity tree: vertex/index buffers of every mesh part plus
+/// decoded base-color textures. Shared meshes are only counted once.
+@MainActor
+enum ModelCost {
+
+    static func bytes(of entity: Entity) -> Int {
+        var meshes = Set<ObjectIdentifier>()
+        return max(bytes(of: entity, seen: &meshes), 1)
+    }
+
+    private static func bytes(of entity: Entity, seen: inout Set<ObjectIdentifier>) -> Int {
+        var total = 0
+        if let model = (entity as? HasModel)?.model,
+           seen.insert(ObjectIdentifier(model.mesh)).inserted {
+            for mesh in model.mesh.contents.models {
+                for part in mesh.parts {
+                    total += part.positions.count * MemoryLayout<SIMD3<Float>>.stride
+                    total += (part.normals?.count ?? 0) * MemoryLayout<SIMD3<Float>>.stride
+                    total += (part.textureCoordinates?.count ?? 0) * MemoryLayout<SIMD2<Float>>.stride
+                    total += (part.triangleIndices?.count ?? 0) * MemoryLayout<UInt32>.stride
+                }
+            }
+            for material in model.materials {
+                if let texture = (material as? PhysicallyBasedMaterial)?.baseColor.texture?.resource {
+                    total += texture.width * texture.height * 4
+                }
+            }
+        }
+        for child in entity.children {
+            total += bytes(of: child, seen: &seen)
+        }
+        return total
     }
 }
@@ -1,52 +1,6 @@
 import SwiftUI
 import SceneKit
 
-// Lightweight inline scene cache to avoid touching the Xcode project file.
-private final class InlineSceneCache {
-    static let shared = InlineSceneCache()
-    private let cache = NSCache<NSString, SCNScene>()
-    private init() {
-        cache.countLimit = 12
-        cache.totalCostLimit = 200 * 1024 * 1024
-    }
-
-    func scene(for name: String) -> SCNScene? {
-        cache.object(forKey: name as NSString)
-    }
-
-    func set(_ scene: SCNScene, for name: String) {
-        cache.setObject(scene, forKey: name as NSString, cost: 1)
-    }
-
-    func removeScene(named name: String) {
-        cache.removeObject(forKey: name as NSString)
-    }
-
-    func loadSceneNamed(_ name: String) async -> SCNScene? {
-        if let cached = scene(for: name) { return cached }
-        return await withCheckedContinuation { cont in
-            DispatchQueue.global(qos: .userInitiated).async {
-                let exts = ["usdz", "scn", "dae"]
-                var loaded: SCNScene? = nil
-                for ext in exts {
-                    if let url = Bundle.main.url(forResource: name, withExtension: ext) {
-                        if let scene = try? SCNScene(url: url, options: nil) {
-                            loaded = scene
-                            break
-                        }
-                        if let scene = SCNScene(named: "\(name).\(ext)") {
-                            loaded = scene
-                            break
-                        }
-                    }
-                }
-                if let s = loaded { InlineSceneCache.shared.set(s, for: name) }
-                cont.resume(returning: loaded)
-            }
-        }
-    }
-}
-
 struct ModelViewerSheet: View {
     let modelName: String
     @Environment(\.dismiss) private var dismiss
@@ -136,8 +90,8 @@ struct ModelViewerSheet: View {
 
     private func loadScene() async {
         loading = true
-        // Use the inline cache to load the scene off-main and reuse cached instances.
-        if let loaded = await InlineSceneCache.shared.loadSceneNamed(modelName) {
+        // Loads off-main; a prefetch already in flight for this model is joined, not repeated.
+        if let loaded = await SceneCache.shared.loadScene(named: modelName) {
             await MainActor.run {
                 self.scene = loaded
                 self.loading = false
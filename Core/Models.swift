@@ -3,47 +3,21 @@ import SwiftUI
 // MARK: - Models
 import Foundation
 
-struct Product: Identifiable, Hashable {
-    let id = UUID()
-    let name: String
-    let price: Double
-    let imageSystemName: String
-    let category: String
-
-    /// Main marketing / info copy shown in detail view + cards.
-    let description: String
-
-    /// Optional USDZ file name (without extension) for 3D preview.
-    let modelName: String?
-
-    /// Optional bundled thumbnail resource name (without extension). If present we preload and cache this image.
-    let thumbnailName: String? = nil
-}
-
 struct Order: Identifiable {
-    let id = UUID()
+    let id: UUID
     let product: Product
     let date: Date
     var status: OrderStatus
-}
 
-enum OrderStatus: String, CaseIterable {
-    case processing = "Processing"
-    case preparing  = "Preparing for Shipment"
-    case shipped    = "Shipped"
-    case delivered  = "Delivered"
-
-    var displayName: String { rawValue }
-
-    var next: OrderStatus? {
-        switch self {
-        case .processing: return .preparing
-        case .preparing:  return .shipped
-        case .shipped:    return .delivered
-        case .delivered:  return nil
-        }
+    init(id: UUID = UUID(), product: Product, date: Date, status: OrderStatus) {
+        self.id = id
+        self.product = product
+        self.date = date
+        self.status = status
     }
+}
 
+extension OrderStatus {
     var tint: SwiftUI.Color {
         switch self {
         case .processing: return .orange
@@ -0,0 +1,161 @@
+import Foundation
+
+/// A position in `OrderHistory` for newest-first paging.
+/// Rows are append-only, so a cursor stays valid while new orders arrive (until `removeAll`,
+/// which StoreModel only does when its initial load replaces the history).
+struct OrderCursor: Hashable, Sendable {
+    /// Exclusive upper row bound of the next page.
+    fileprivate let end: Int
+}
+
+/// One order as stored: product by dense catalog ID, no Product copy.
+struct OrderRow: Identifiable, Hashable, Sendable {
+    let id: UUID
+    let productID: CatalogID
+    let date: Date
+    let status: OrderStatus
+}
+
+struct OrderPage: Sendable {
+    /// Newest first.
+    let rows: [OrderRow]
+    /// Cursor for the next (older) page, or nil when this page reaches the first order.
+    let next: OrderCursor?
+}
+
+/// A status change produced by a bulk transition, for journaling.
+struct OrderStatusChange: Hashable, Sendable {
+    let id: UUID
+    let status: OrderStatus
+}
+
+/// Columnar order history: parallel arrays indexed by row, oldest first.
+///
+/// Per order this keeps a UUID, a 4-byte `CatalogID`, a `Date` and a 1-byte status code
+/// (plus one id → row map entry) instead of a full `Product` copy.
+/// Not thread-safe; StoreModel owns it on the main actor and publishes changes itself.
+final class OrderHistory {
+
+    private(set) var ids: [UUID] = []
+    private(set) var productIDs: [CatalogID] = []
+    private(set) var dates: [Date] = []
+    private(set) var statusCodes: [UInt8] = []
+    private var rowByID: [UUID: Int] = [:]
+
+    var count: Int { ids.count }
+    var isEmpty: Bool { ids.isEmpty }
+
+    init() {}
+
+    func reserveCapacity(_ n: Int) {
+        ids.reserveCapacity(n)
+        productIDs.reserveCapacity(n)
+        dates.reserveCapacity(n)
+        statusCodes.reserveCapacity(n)
+        rowByID.reserveCapacity(n)
+    }
+
+    func removeAll() {
+        ids.removeAll()
+        productIDs.removeAll()
+        dates.removeAll()
+        statusCodes.removeAll()
+        rowByID.removeAll()
+    }
+
+    // MARK: - Rows
+
+    func append(id: UUID, productID: CatalogID, date: Date, status: OrderStatus = .processing) {
+        guard rowByID[id] == nil else { return }
+        rowByID[id] = ids.count
+        ids.append(id)
+        productIDs.append(productID)
+        dates.append(date)
+        statusCodes.append(status.code)
+    }
+
+    func row(at index: Int) -> OrderRow {
+        OrderRow(
+            id: ids[index],
+            productID: productIDs[index],
+            date: dates[index],
+            status: OrderStatus(code: statusCodes[index]) ?? .processing
+        )
+    }
+
+    func row(for id: UUID) -> OrderRow? {
+        rowByID[id].map(row(at:))
+    }
+
+    func status(of id: UUID) -> OrderStatus? {
+        rowByID[id].flatMap { OrderStatus(code: statusCodes[$0]) }
+    }
+
+    // MARK: - Paging
+
+    /// Up to `limit` orders older than `cursor` (or the newest ones when nil), newest first.
+    func page(before cursor: OrderCursor? = nil, limit: Int) -> OrderPage {
+        let end = min(cursor?.end ?? count, count)
+        let start = max(end - max(limit, 0), 0)
+        var rows: [OrderRow] = []
+        rows.reserveCapacity(end - start)
+        for i in stride(from: end - 1, through: start, by: -1) {
+            rows.append(row(at: i))
+        }
+        return OrderPage(rows: rows, next: start > 0 ? OrderCursor(end: start) : nil)
+    }
+
+    // MARK: - Status transitions
+
+    /// Moves one order to its next status. Returns the change, or nil if unknown or delivered.
+    @discardableResult
+    func advance(_ id: UUID) -> OrderStatusChange? {
+        guard let i = rowByID[id] else { return nil }
+        return advanceRow(i)
+    }
+
+    /// Advances every listed order one step in a single pass.
+    func advance<S: Sequence>(_ ids: S) -> [OrderStatusChange] where S.Element == UUID {
+        var changes: [OrderStatusChange] = []
+        for id in ids {
+            if let i = rowByID[id], let change = advanceRow(i) {
+                changes.append(change)
+            }
+        }
+        return changes
+    }
+
+    /// Whether `advance(ids)` would move at least one order. Stops at the first that would.
+    func canAdvance<S: Sequence>(any ids: S) -> Bool where S.Element == UUID {
+        ids.contains { id in
+            guard let i = rowByID[id] else { return false }
+            return OrderStatus(code: statusCodes[i])?.next != nil
+        }
+    }
+
+    /// Whether `advanceAll(from: status)` would move at least one order.
+    func canAdvanceAll(from status: OrderStatus) -> Bool {
+        status.next != nil && statusCodes.contains(status.code)
+    }
+
+    /// Advances every order currently in `status` one step, scanning only the status column.
+    func advanceAll(from status: OrderStatus) -> [OrderStatusChange] {
+        guard let next = status.next else { return [] }
+        let from = status.code
+        let to = next.code
+        var changes: [OrderStatusChange] = []
+        statusCodes.withUnsafeMutableBufferPointer { codes in
+            for i in codes.indices where codes[i] == from {
+                codes[i] = to
+                changes.append(OrderStatusChange(id: ids[i], status: next))
+            }
+        }
+        return changes
+    }
+
+    private func advanceRow(_ i: Int) -> OrderStatusChange? {
+        guard let current = OrderStatus(code: statusCodes[i]), let next = current.next else { return nil }
+        statusCodes[i] = next.code
+        return OrderStatusChange(id: ids[i], status: next)
+    }
+}
@@ -0,0 +1,42 @@
+import Foundation
+
+/// Order lifecycle. Foundation-only so persistence and the order store can build on Linux;
+/// SwiftUI presentation (`tint`) lives in Models.swift.
+enum OrderStatus: String, CaseIterable, Codable, Sendable {
+    case processing = "Processing"
+    case preparing  = "Preparing for Shipment"
+    case shipped    = "Shipped"
+    case delivered  = "Delivered"
+
+    var displayName: String { rawValue }
+
+    var next: OrderStatus? {
+        switch self {
+        case .processing: return .preparing
+        case .preparing:  return .shipped
+        case .shipped:    return .delivered
+        case .delivered:  return nil
+        }
+    }
+
+    /// Compact on-disk / columnar code. Written into snapshots, so each case keeps its number
+    /// forever: new cases take the next unused code, regardless of where they're declared.
+    var code: UInt8 {
+        switch self {
+        case .processing: return 0
+        case .preparing:  return 1
+        case .shipped:    return 2
+        case .delivered:  return 3
+        }
+    }
+
+    init?(code: UInt8) {
+        switch code {
+        case 0: self = .processing
+        case 1: self = .preparing
+        case 2: self = .shipped
+        case 3: self = .delivered
+        default: return nil
+        }
+    }
+}
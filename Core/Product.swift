@@ -0,0 +1,20 @@
+import Foundation
+
+/// Catalog product. Kept Foundation-only so the catalog/search/cache cores can be
+/// compiled and benchmarked on Linux without SwiftUI.
+struct Product: Identifiable, Hashable {
+    let id = UUID()
+    let name: String
+    let price: Double
+    let imageSystemName: String
+    let category: String
+
+    /// Main marketing / info copy shown in detail view + cards.
+    let description: String
+
+    /// Optional USDZ file name (without extension) for 3D preview.
+    let modelName: String?
+
+    /// Optional bundled thumbnail resource name (without extension). If present we preload and cache this image.
+    let thumbnailName: String? = nil
+}
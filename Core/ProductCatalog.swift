@@ -2,10 +2,42 @@ import Foundation
 
 /// Central catalog keyed by the same String IDs stored in StoreModel.
 /// Product itself can remain UUID-identifiable for now.
+///
+/// Backed by an immutable `ProductStore` loaded once from `ProductCatalog.json` in the bundle.
+/// If the file is missing or malformed we fall back to the built-in records below.
 enum ProductCatalog {
 
-    static let catalog: [String: Product] = [
-        "foundation_hub": Product(
+    static let store: ProductStore = {
+        if let url = Bundle.main.url(forResource: "ProductCatalog", withExtension: "json"),
+           let loaded = try? ProductStore.load(contentsOf: url),
+           loaded.count > 0 {
+            return loaded
+        }
+        return ProductStore(records: builtIn)
+    }()
+
+    static var all: [Product] {
+        store.all
+    }
+
+    static func product(for key: String) -> Product? {
+        store.product(for: key)
+    }
+
+    static func products(for keys: [String]) -> [Product] {
+        store.products(for: keys)
+    }
+
+    /// Reverse lookup: find the catalog key for a product.
+    /// O(1) by UUID, falling back to name+category+price+icon for products built elsewhere.
+    static func key(for product: Product) -> String? {
+        store.key(for: product)
+    }
+
+    /// Fallback records, kept in sync with Config/ProductCatalog.json.
+    static let builtIn: [CatalogRecord] = [
+        CatalogRecord(
+            key: "foundation_hub",
             name: "Foundation Hub",
             price: 199.0,
             imageSystemName: "sparkles",
@@ -13,8 +45,8 @@ enum ProductCatalog {
             description: "Command surface for the Foundation ecosystem.",
             modelName: "foundation_hub"
         ),
-
-        "onyx_module": Product(
+        CatalogRecord(
+            key: "onyx_module",
             name: "Onyx Module",
             price: 149.0,
             imageSystemName: "cube.transparent",
@@ -22,8 +54,8 @@ enum ProductCatalog {
             description: "Expandable hardware module for future devices.",
             modelName: "onyx_module"
         ),
-
-        "signal_dock": Product(
+        CatalogRecord(
+            key: "signal_dock",
             name: "Signal Dock",
             price: 89.0,
             imageSystemName: "bolt.horizontal",
@@ -32,7 +64,8 @@ enum ProductCatalog {
             modelName: nil
         ),
         // Chipsets (Foundation Silicon)
-        "F-CORE A1": Product(
+        CatalogRecord(
+            key: "F-CORE A1",
             name: "F-CORE A1",
             price: 249.00,
             imageSystemName: "cpu",
@@ -40,7 +73,8 @@ enum ProductCatalog {
             description: "Foundation-grade compute core for embedded builds and dock systems.",
             modelName: "FCORE_A1"
         ),
-        "ONYX Neural Tile": Product(
+        CatalogRecord(
+            key: "ONYX Neural Tile",
             name: "ONYX Neural Tile",
             price: 399.00,
             imageSystemName: "brain",
@@ -48,7 +82,8 @@ enum ProductCatalog {
             description: "Low-latency neural processing tile for Onyx devices.",
             modelName: "OnyxNeuralTile"
         ),
-        "Signal ASIC": Product(
+        CatalogRecord(
+            key: "Signal ASIC",
             name: "Signal ASIC",
             price: 179.00,
             imageSystemName: "wave.3.right",
@@ -57,40 +92,18 @@ enum ProductCatalog {
             modelName: nil
         )
     ]
-
-    static var all: [Product] {
-        catalog
-            .sorted(by: { $0.key < $1.key })
-            .map { $0.value }
-    }
-
-    static func product(for key: String) -> Product? {
-        catalog[key]
-    }
-
-    static func products(for keys: [String]) -> [Product] {
-        keys.compactMap { catalog[$0] }
-    }
-
-    /// Reverse lookup: find the catalog key for a product.
-    /// Uses stable matching by name+category+price+icon to avoid UUID mismatch.
-    static func key(for product: Product) -> String? {
-        catalog.first(where: { _, p in
-            p.name == product.name &&
-            p.category == product.category &&
-            p.price == product.price &&
-            p.imageSystemName == product.imageSystemName
-        })?.key
-    }
 }
 extension ProductCatalog {
     static var categories: [String] {
-        Array(Set(catalog.values.map { $0.category }))
-            .sorted()
+        store.categories
     }
 
     static func products(in category: String) -> [Product] {
-        all.filter { $0.category == category }
+        store.products(in: category)
+    }
+
+    static func products(priced range: ClosedRange<Double>) -> [Product] {
+        store.products(priced: range)
     }
 
     static var featuredKeys: [String] = [
@@ -106,4 +119,7 @@ extension ProductCatalog {
     static var chipsets: [Product] {
         products(in: "Chipsets")
     }
-}
\ No newline at end of file
+
+    /// Built on first search, off the main actor (see ProductSearchSession).
+    static let searchIndex = ProductSearchIndex(store: store)
+}
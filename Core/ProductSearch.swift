@@ -0,0 +1,292 @@
+import Foundation
+
+/// A ranked search result. Higher `score` is better; ties keep catalog file order.
+struct SearchHit: Hashable, Sendable {
+    let id: CatalogID
+    let score: Int
+}
+
+/// Prefix inverted index over product name, category and description.
+///
+/// Text is case/diacritic/width folded and split into alphanumeric tokens; every token prefix
+/// up to `maxPrefixLength` characters gets a posting list of (id, weight) sorted by id.
+/// A query is the AND of its tokens, each treated as a prefix, so "onyx ti" finds "ONYX Neural Tile".
+/// Immutable after `init`, so it can be shared across tasks.
+final class ProductSearchIndex: Sendable {
+
+    struct Posting: Sendable {
+        let id: CatalogID
+        let weight: UInt8
+    }
+
+    /// Per-field weights. A token prefix keeps the best weight it reaches in a product.
+    private enum Weight {
+        static let name: UInt8 = 8
+        static let category: UInt8 = 4
+        static let description: UInt8 = 1
+        /// Added when the query token is a whole word, not just a prefix.
+        static let exact: UInt8 = 3
+        /// Added when the word leads the product name.
+        static let leading: UInt8 = 2
+    }
+
+    let store: ProductStore
+    let maxPrefixLength: Int
+
+    private let postings: [String: [Posting]]
+    /// Normalized tokens per product, only used to verify query tokens longer than `maxPrefixLength`.
+    private let docTokens: [[String]]
+
+    init(store: ProductStore, maxPrefixLength: Int = 12) {
+        self.store = store
+        self.maxPrefixLength = maxPrefixLength
+
+        var postings: [String: [Posting]] = [:]
+        var docTokens: [[String]] = []
+        docTokens.reserveCapacity(store.count)
+
+        // Products are visited in id order, so every posting list comes out sorted by id.
+        for (i, product) in store.products.enumerated() {
+            var best: [String: UInt8] = [:]
+            var tokens: [String] = []
+
+            func add(_ text: String, weight: UInt8, minLength: Int) {
+                for (n, token) in Self.tokenize(text).enumerated() where token.count >= minLength {
+                    tokens.append(token)
+                    let lead = weight == Weight.name && n == 0 ? Weight.leading : 0
+                    var prefix = ""
+                    for ch in token.prefix(maxPrefixLength) {
+                        prefix.append(ch)
+                        let w = weight + lead + (prefix.count == token.count ? Weight.exact : 0)
+                        if w > best[prefix, default: 0] {
+                            best[prefix] = w
+                        }
+                    }
+                }
+            }
+
+            add(product.name, weight: Weight.name, minLength: 1)
+            add(product.category, weight: Weight.category, minLength: 1)
+            // Short description words are mostly noise and would bloat the index.
+            add(product.description, weight: Weight.description, minLength: 3)
+
+            let id = CatalogID(i)
+            for (prefix, w) in best {
+                postings[prefix, default: []].append(Posting(id: id, weight: w))
+            }
+            docTokens.append(tokens)
+        }
+
+        self.postings = postings
+        self.docTokens = docTokens
+    }
+
+    // MARK: - Normalization
+
+    /// Folds case, diacritics and width, then splits on anything that isn't a letter or digit.
+    static func tokenize(_ text: String) -> [String] {
+        text.folding(options: [.caseInsensitive, .diacriticInsensitive, .widthInsensitive], locale: nil)
+            .split(whereSeparator: { !$0.isLetter && !$0.isNumber })
+            .map(String.init)
+    }
+
+    // MARK: - Query
+
+    /// One-shot ranked search. For type-ahead use `ProductSearchSession`, which refines incrementally.
+    func search(_ query: String, limit: Int = 50) -> [SearchHit] {
+        let tokens = Self.tokenize(query)
+        guard !tokens.isEmpty else { return [] }
+        return rank(matches(for: tokens), limit: limit)
+    }
+
+    /// Posting list for one normalized query token.
+    func postings(for token: String) -> [Posting] {
+        guard token.count > maxPrefixLength else {
+            return postings[token] ?? []
+        }
+        let key = String(token.prefix(maxPrefixLength))
+        return (postings[key] ?? []).filter { p in
+            docTokens[Int(p.id)].contains { $0.hasPrefix(token) }
+        }
+    }
+
+    /// Full (unranked) match set for `tokens`, sorted by id.
+    func matches(for tokens: [String]) -> [SearchMatch] {
+        guard let last = tokens.last else { return [] }
+
+        // Intersect the leading tokens smallest-first, then apply the last token on its own
+        // so its weight stays separable for incremental refinement.
+        let leading = tokens.dropLast().map { postings(for: $0) }.sorted { $0.count < $1.count }
+        var candidates: [SearchMatch]
+        if let first = leading.first {
+            candidates = first.map { SearchMatch(id: $0.id, base: Int($0.weight), last: 0) }
+            for list in leading.dropFirst() {
+                candidates = Self.intersect(candidates, list) { m, w in
+                    SearchMatch(id: m.id, base: m.base + Int(w), last: 0)
+                }
+            }
+            return Self.intersect(candidates, postings(for: last)) { m, w in
+                SearchMatch(id: m.id, base: m.base, last: Int(w))
+            }
+        }
+        return postings(for: last).map { SearchMatch(id: $0.id, base: 0, last: Int($0.weight)) }
+    }
+
+    /// Narrows a previous match set after the query was extended.
+    /// `previous` must be the match set for `old`, and `new` must satisfy `extends(_:_:)`.
+    func refine(_ previous: [SearchMatch], from old: [String], to new: [String]) -> [SearchMatch] {
+        guard !old.isEmpty, new.count >= old.count else { return matches(for: new) }
+
+        // Everything before the old last token is unchanged; its weight is already in `base`.
+        var candidates = previous.map { SearchMatch(id: $0.id, base: $0.base, last: 0) }
+        for token in new[(old.count - 1)..<(new.count - 1)] {
+            candidates = Self.intersect(candidates, postings(for: token)) { m, w in
+                SearchMatch(id: m.id, base: m.base + Int(w), last: 0)
+            }
+        }
+        return Self.intersect(candidates, postings(for: new[new.count - 1])) { m, w in
+            SearchMatch(id: m.id, base: m.base, last: Int(w))
+        }
+    }
+
+    /// True when every result for `new` is also a result for `old`
+    /// (same leading tokens, old last token extended, extra tokens appended).
+    static func extends(_ new: [String], _ old: [String]) -> Bool {
+        guard !old.isEmpty, new.count >= old.count else { return false }
+        let k = old.count - 1
+        for i in 0..<k where new[i] != old[i] {
+            return false
+        }
+        return new[k].hasPrefix(old[k])
+    }
+
+    /// Top `limit` matches by score. Scores are small integers, so this buckets instead of sorting.
+    func rank(_ matches: [SearchMatch], limit: Int) -> [SearchHit] {
+        guard !matches.isEmpty, limit > 0 else { return [] }
+        let top = matches.reduce(0) { max($0, $1.score) }
+        var buckets = [[CatalogID]](repeating: [], count: top + 1)
+        for m in matches {
+            buckets[m.score].append(m.id)
+        }
+
+        var out: [SearchHit] = []
+        out.reserveCapacity(min(limit, matches.count))
+        for score in stride(from: buckets.count - 1, through: 0, by: -1) {
+            for id in buckets[score] {
+                out.append(SearchHit(id: id, score: score))
+                if out.count == limit { return out }
+            }
+        }
+        return out
+    }
+
+    /// Sorted-by-id intersection. Gallops through `list` when `candidates` is much smaller.
+    private static func intersect(
+        _ candidates: [SearchMatch],
+        _ list: [Posting],
+        _ combine: (SearchMatch, UInt8) -> SearchMatch
+    ) -> [SearchMatch] {
+        var out: [SearchMatch] = []
+        guard !candidates.isEmpty, !list.isEmpty else { return out }
+        out.reserveCapacity(min(candidates.count, list.count))
+
+        if candidates.count * 8 < list.count {
+            var lo = 0
+            for m in candidates {
+                var hi = list.count
+                while lo < hi {
+                    let mid = (lo + hi) / 2
+                    if list[mid].id < m.id { lo = mid + 1 } else { hi = mid }
+                }
+                if lo == list.count { break }
+                if list[lo].id == m.id {
+                    out.append(combine(m, list[lo].weight))
+                }
+            }
+            return out
+        }
+
+        var i = 0
+        var j = 0
+        while i < candidates.count && j < list.count {
+            let a = candidates[i].id
+            let b = list[j].id
+            if a == b {
+                out.append(combine(candidates[i], list[j].weight))
+                i += 1
+                j += 1
+            } else if a < b {
+                i += 1
+            } else {
+                j += 1
+            }
+        }
+        return out
+    }
+}
+
+/// One product in a match set. `base` is the weight from every query token except the last.
+struct SearchMatch: Sendable {
+    let id: CatalogID
+    let base: Int
+    let last: Int
+
+    var score: Int { base + last }
+}
+
+/// Type-ahead search state. Runs off the main actor; when the new query extends the previous one
+/// it narrows the previous match set instead of starting over.
+/// Callers cancel by cancelling the calling Task (e.g. SwiftUI's `.task(id:)`).
+actor ProductSearchSession {
+
+    private let makeIndex: @Sendable () -> ProductSearchIndex
+    private var builtIndex: ProductSearchIndex?
+
+    private var lastTokens: [String] = []
+    private var lastMatches: [SearchMatch] = []
+
+    /// `index` is resolved on first query, so building it never lands on the caller's thread.
+    init(index: @escaping @autoclosure @Sendable () -> ProductSearchIndex) {
+        self.makeIndex = index
+    }
+
+    private var index: ProductSearchIndex {
+        if let builtIndex { return builtIndex }
+        let made = makeIndex()
+        builtIndex = made
+        return made
+    }
+
+    /// Top `limit` products for `query`, optionally only among `allowed`. Throws
+    /// `CancellationError` if the calling task was cancelled.
+    func search(_ query: String, limit: Int = 200, within allowed: Set<CatalogID>? = nil) throws -> [Product] {
+        let index = self.index
+        let tokens = ProductSearchIndex.tokenize(query)
+        guard !tokens.isEmpty else {
+            reset()
+            return []
+        }
+        try Task.checkCancellation()
+
+        let matches: [SearchMatch]
+        if tokens == lastTokens {
+            matches = lastMatches
+        } else if ProductSearchIndex.extends(tokens, lastTokens) {
+            matches = index.refine(lastMatches, from: lastTokens, to: tokens)
+        } else {
+            matches = index.matches(for: tokens)
+        }
+        try Task.checkCancellation()
+
+        lastTokens = tokens
+        lastMatches = matches
+        // Scope before ranking so the top `limit` are all ones the caller can show.
+        let scoped = allowed.map { allowed in matches.filter { allowed.contains($0.id) } } ?? matches
+        return index.rank(scoped, limit: limit).map { index.store.product(at: $0.id) }
+    }
+
+    func reset() {
+        lastTokens = []
+        lastMatches = []
+    }
+}
@@ -0,0 +1,226 @@
+import Foundation
+
+/// Dense, zero-based index of a product inside a `ProductStore`.
+/// Stable for the lifetime of the store (assigned in catalog file order).
+typealias CatalogID = Int32
+
+/// One row of the catalog file. `key` is the same String ID stored in StoreModel.
+struct CatalogRecord: Codable, Hashable {
+    let key: String
+    let name: String
+    let price: Double
+    let imageSystemName: String
+    let category: String
+    let description: String
+    let modelName: String?
+
+    var product: Product {
+        Product(
+            name: name,
+            price: price,
+            imageSystemName: imageSystemName,
+            category: category,
+            description: description,
+            modelName: modelName
+        )
+    }
+}
+
+/// Immutable, index-backed catalog.
+/// Everything is built once in `init`; afterwards lookups are O(1) and list accessors
+/// return precomputed arrays, so SwiftUI bodies can hit them freely.
+/// Foundation-only so it can be benchmarked on Linux (see tools/bench/catalog).
+final class ProductStore: Sendable {
+
+    /// Fields used to match a Product that was built outside the catalog (fresh UUID).
+    private struct Signature: Hashable {
+        let name: String
+        let category: String
+        let price: Double
+        let imageSystemName: String
+
+        init(_ p: Product) {
+            name = p.name
+            category = p.category
+            price = p.price
+            imageSystemName = p.imageSystemName
+        }
+    }
+
+    // MARK: - Dense tables (indexed by CatalogID)
+
+    let keys: [String]
+    let products: [Product]
+
+    // MARK: - Lookup maps
+
+    private let idByKey: [String: CatalogID]
+    private let idByProductID: [UUID: CatalogID]
+    private let idBySignature: [Signature: CatalogID]
+
+    // MARK: - Precomputed orders
+
+    /// IDs sorted by key (the historical `ProductCatalog.all` order).
+    let sortedIDs: [CatalogID]
+    /// Position of each ID within `sortedIDs`.
+    private let sortedPositions: [Int]
+    /// Products in `sortedIDs` order.
+    let all: [Product]
+    /// Distinct categories, sorted.
+    let categories: [String]
+    /// Per-category posting lists, each in key order.
+    private let postings: [String: [CatalogID]]
+    private let productsByCategory: [String: [Product]]
+    /// IDs sorted by ascending price (key breaks ties).
+    let priceIndex: [CatalogID]
+    /// Prices parallel to `priceIndex`, for binary search.
+    private let sortedPrices: [Double]
+
+    var count: Int { products.count }
+
+    /// Builds every index up front. Duplicate keys keep the first occurrence.
+    init(records: [CatalogRecord]) {
+        var keys: [String] = []
+        var products: [Product] = []
+        var idByKey: [String: CatalogID] = [:]
+        keys.reserveCapacity(records.count)
+        products.reserveCapacity(records.count)
+        idByKey.reserveCapacity(records.count)
+
+        for record in records where idByKey[record.key] == nil {
+            idByKey[record.key] = CatalogID(keys.count)
+            keys.append(record.key)
+            products.append(record.product)
+        }
+
+        var idByProductID: [UUID: CatalogID] = [:]
+        var idBySignature: [Signature: CatalogID] = [:]
+        idByProductID.reserveCapacity(products.count)
+        idBySignature.reserveCapacity(products.count)
+        for (i, p) in products.enumerated() {
+            idByProductID[p.id] = CatalogID(i)
+            // Identical signatures are ambiguous; keep the first so results are deterministic.
+            if idBySignature[Signature(p)] == nil {
+                idBySignature[Signature(p)] = CatalogID(i)
+            }
+        }
+
+        let sortedIDs = (0..<CatalogID(keys.count)).sorted { keys[Int($0)] < keys[Int($1)] }
+
+        var postings: [String: [CatalogID]] = [:]
+        for id in sortedIDs {
+            postings[products[Int(id)].category, default: []].append(id)
+        }
+
+        let priceIndex = sortedIDs.sorted { a, b in
+            let pa = products[Int(a)].price
+            let pb = products[Int(b)].price
+            return pa != pb ? pa < pb : keys[Int(a)] < keys[Int(b)]
+        }
+
+        self.keys = keys
+        self.products = products
+        self.idByKey = idByKey
+        self.idByProductID = idByProductID
+        self.idBySignature = idBySignature
+        self.sortedIDs = sortedIDs
+        var sortedPositions = [Int](repeating: 0, count: sortedIDs.count)
+        for (position, id) in sortedIDs.enumerated() {
+            sortedPositions[Int(id)] = position
+        }
+        self.sortedPositions = sortedPositions
+        self.all = sortedIDs.map { products[Int($0)] }
+        self.categories = postings.keys.sorted()
+        self.postings = postings
+        self.productsByCategory = postings.mapValues { ids in ids.map { products[Int($0)] } }
+        self.priceIndex = priceIndex
+        self.sortedPrices = priceIndex.map { products[Int($0)].price }
+    }
+
+    // MARK: - Lookup
+
+    func id(for key: String) -> CatalogID? {
+        idByKey[key]
+    }
+
+    func product(for key: String) -> Product? {
+        idByKey[key].map { products[Int($0)] }
+    }
+
+    func product(at id: CatalogID) -> Product {
+        products[Int(id)]
+    }
+
+    func key(at id: CatalogID) -> String {
+        keys[Int(id)]
+    }
+
+    func products(for keys: [String]) -> [Product] {
+        keys.compactMap { product(for: $0) }
+    }
+
+    /// Reverse lookup. O(1): exact catalog instances match by UUID, anything else
+    /// falls back to name+category+price+icon.
+    func id(for product: Product) -> CatalogID? {
+        idByProductID[product.id] ?? idBySignature[Signature(product)]
+    }
+
+    func key(for product: Product) -> String? {
+        id(for: product).map { keys[Int($0)] }
+    }
+
+    // MARK: - Indices
+
+    /// Up to `count` IDs that follow `id` in catalog (key) order, wrapping past the end.
+    func ids(after id: CatalogID, count: Int) -> [CatalogID] {
+        let n = sortedIDs.count
+        guard n > 1, count > 0, Int(id) >= 0, Int(id) < n else { return [] }
+        let start = sortedPositions[Int(id)]
+        return (1...min(count, n - 1)).map { sortedIDs[(start + $0) % n] }
+    }
+
+    /// IDs in `category`, in key order.
+    func ids(in category: String) -> [CatalogID] {
+        postings[category] ?? []
+    }
+
+    func products(in category: String) -> [Product] {
+        productsByCategory[category] ?? []
+    }
+
+    /// Products priced within `range`, cheapest first. O(log n + k).
+    func products(priced range: ClosedRange<Double>) -> [Product] {
+        let lower = firstPriceIndex { $0 >= range.lowerBound }
+        let upper = firstPriceIndex { $0 > range.upperBound }
+        guard lower < upper else { return [] }
+        return priceIndex[lower..<upper].map { products[Int($0)] }
+    }
+
+    /// Lower-bound search over `sortedPrices` for a monotonic predicate.
+    private func firstPriceIndex(where predicate: (Double) -> Bool) -> Int {
+        var lo = 0
+        var hi = sortedPrices.count
+        while lo < hi {
+            let mid = (lo + hi) / 2
+            if predicate(sortedPrices[mid]) {
+                hi = mid
+            } else {
+                lo = mid + 1
+            }
+        }
+        return lo
+    }
+}
+
+// MARK: - Loading
+
+extension ProductStore {
+
+    /// Decodes a JSON array of `CatalogRecord` and indexes it.
+    /// The file is memory-mapped when possible so large catalogs don't get copied first.
+    static func load(contentsOf url: URL) throws -> ProductStore {
+        let data = try Data(contentsOf: url, options: .mappedIfSafe)
+        let records = try JSONDecoder().decode([CatalogRecord].self, from: data)
+        return ProductStore(records: records)
+    }
+}
@@ -120,63 +120,15 @@ struct RealityKitViewer: View {
         // If task was cancelled before we start, bail out early.
         if Task.isCancelled { return }
 
-        // Try cached copy first (fast path)
-        if let cached = try? await ModelCache.shared.getClone(for: modelName) {
-            await MainActor.run {
-                self.entity = cached
-                self.loading = false
-            }
-            return
-        }
-
-        // Try to find a bundled USDZ URL first
-        if let url = Bundle.main.url(forResource: modelName, withExtension: "usdz") {
-            do {
-                let loaded = try await ModelEntity.loadModelAsync(contentsOf: url).value
-
-                // Cache the loaded original entity (so subsequent requests return clones)
-                await ModelCache.shared.set(loaded, for: modelName)
+        // Cached or shared load; either way we get our own clone, never the cached instance.
+        let loaded = await ModelCache.shared.clone(named: modelName)
 
-                // Return a clone to the UI so we don't hand out the cached instance directly.
-                let clone = try? await ModelCache.shared.getClone(for: modelName)
-
-                await MainActor.run {
-                    self.entity = clone
-                    self.loading = false
-                }
-            } catch {
-                // If cancelled, don't report a user-facing error.
-                if Task.isCancelled { return }
-                await MainActor.run {
-                    self.loadError = error.localizedDescription
-                    self.loading = false
-                }
-            }
-            return
-        }
-
-        // Fallback: attempt to load by name from bundle resources
-        do {
-            let result = try await Entity.loadAsync(named: modelName).value
-            if let modelEntity = result as? ModelEntity {
-                await ModelCache.shared.set(modelEntity, for: modelName)
-                let clone = try? await ModelCache.shared.getClone(for: modelName)
-                await MainActor.run {
-                    self.entity = clone
-                    self.loading = false
-                }
-            } else {
-                await MainActor.run {
-                    self.loadError = "Loaded entity is not a ModelEntity"
-                    self.loading = false
-                }
-            }
-        } catch {
-            if Task.isCancelled { return }
-            await MainActor.run {
-                self.loadError = error.localizedDescription
-                self.loading = false
-            }
+        // If cancelled, don't report a user-facing error.
+        if Task.isCancelled { return }
+        await MainActor.run {
+            self.entity = loaded
+            self.loadError = loaded == nil ? "Couldn’t load \(modelName).usdz" : nil
+            self.loading = false
         }
     }
 }
@@ -9,23 +9,105 @@
 import Foundation
 import SwiftUI
 
-// Removed @MainActor so the detached background Task actually runs off-main.
+/// The app's startup warmup plan, run by `WarmupScheduler`.
+/// Catalog first, then search and summaries, then 3D assets; how far it gets depends on the
+/// performance tier. The first user interaction drops whatever hasn't started and cancels the
+/// running 3D loads (low priority); catalog, search and summary work already running finishes.
 enum StartupWarmup {
 
-    static func run() {
-        // Touch catalog once to warm dictionary / decoding / allocations.
-        // Do the bulk of these touches off the main actor to avoid delaying the first frame.
-        Task.detached(priority: .background) {
-            _ = ProductCatalog.all
+    /// The running (or finished) warmup, so interaction handlers and the debug panel can reach it.
+    @MainActor private(set) static var current: WarmupScheduler?
+    @MainActor private static var interacted = false
 
-            // Touch currency formatting once (expensive on first call sometimes).
-            let f = FloatingPointFormatStyle<Double>.Currency(code: "USD")
-            _ = 199.0.formatted(f)
+    /// Starts warmup once per launch; later calls return the same scheduler.
+    @MainActor
+    @discardableResult
+    static func run(tier: PerformanceProfile.Tier) -> WarmupScheduler {
+        if let current { return current }
+        let budget = budget(for: tier)
+        let scheduler = WarmupScheduler(tasks: tasks(budget: budget), budget: budget)
+        current = scheduler
+        Task.detached(priority: .utility) {
+            let report = await scheduler.run()
+            for timing in report.tasks {
+                TelemetryRecorder.shared.log("warmup_\(timing.status.rawValue)", source: timing.id)
+            }
+            // Detail views never generate summaries, so if an early tap cancelled this node,
+            // make them anyway once the run is over, one at a time in the background.
+            if report.timing(WarmupPlan.summaries.id)?.status == .cancelled {
+                await AIService.shared.precomputeSummaries(for: ProductCatalog.all, maxConcurrent: 1)
+            }
+        }
+        return scheduler
+    }
 
-            // Small sleep to yield — background sleep
-            try? await Task.sleep(nanoseconds: 1_000_000)
+    /// First tap or scroll: stop starting new warmup work and cancel running low-priority work.
+    @MainActor
+    static func userDidInteract() {
+        guard let current, !interacted else { return }
+        interacted = true
+        Task { await current.userDidInteract() }
+    }
 
-            // If any UI-updates are required from this warm-up, dispatch to the main actor explicitly.
+    /// Throttled tiers warm less and keep fewer cores busy doing it.
+    static func budget(for tier: PerformanceProfile.Tier) -> WarmupBudget {
+        switch tier {
+        case .performance:
+            return WarmupPlan.budget(for: .minimal)
+        case .balanced:
+            return WarmupPlan.budget(for: .standard)
+        case .cinematic:
+            return WarmupPlan.budget(for: .full)
         }
     }
-}
\ No newline at end of file
+
+    /// `WarmupPlan`'s graph with the app's work attached.
+    static func tasks(budget: WarmupBudget) -> [WarmupTask] {
+        let summaryConcurrency = min(2, budget.cpu)
+        return [
+            WarmupPlan.catalog.task {
+                try timed("catalog") {
+                    _ = ProductCatalog.all
+                    _ = ProductCatalog.categories
+                    _ = ProductCatalog.featured
+                }
+            },
+            WarmupPlan.formatters.task {
+                // Currency formatting is expensive on first call.
+                try timed("formatters") {
+                    _ = 199.0.formatted(FloatingPointFormatStyle<Double>.Currency(code: "USD"))
+                }
+            },
+            WarmupPlan.searchIndex.task {
+                try timed("search_index") {
+                    _ = ProductCatalog.searchIndex
+                }
+            },
+            WarmupPlan.summaries.task {
+                // Detail views only read stored summaries; this is where they get made, on every
+                // tier. At most two at a time, matching what the scheduler charges this task.
+                _ = await TelemetryRecorder.shared.measure("warmup", source: "summaries") {
+                    await AIService.shared.precomputeSummaries(for: ProductCatalog.all, maxConcurrent: summaryConcurrency)
+                }
+            },
+            WarmupPlan.scenes.task {
+                let names = ProductCatalog.featured.compactMap(\.modelName)
+                guard !names.isEmpty else { throw WarmupSkipped() }
+                for name in names {
+                    // Low priority, so the first interaction cancels it; stop between scenes.
+                    try Task.checkCancellation()
+                    _ = await SceneCache.shared.cache.value(for: name, priority: .background)
+                }
+            },
+            WarmupPlan.models.task {
+                // The entity RealityKitViewer clones first when a featured product opens in 3D.
+                guard let first = ProductCatalog.featured.lazy.compactMap(\.modelName).first else { throw WarmupSkipped() }
+                _ = await ModelCache.shared.cache.value(for: first, priority: .background)
+            }
+        ]
+    }
+
+    private static func timed(_ id: String, _ body: () throws -> Void) throws {
+        try TelemetryRecorder.shared.measure("warmup", source: id, body)
+    }
+}
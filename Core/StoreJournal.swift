@@ -0,0 +1,421 @@
+import Foundation
+
+// MARK: - Mutations & state
+
+/// One persisted StoreModel change. Replaying the same entry twice is harmless.
+enum StoreMutation: Codable, Equatable, Sendable {
+    case wishlistAdd(key: String)
+    case wishlistRemove(key: String)
+    case orderPlaced(id: UUID, key: String, date: Date)
+    case statusAdvanced(id: UUID, status: OrderStatus)
+}
+
+/// Persisted form of an order: catalog key instead of a full Product copy.
+struct OrderRecord: Equatable, Sendable {
+    let id: UUID
+    let key: String
+    let date: Date
+    var status: OrderStatus
+}
+
+/// Plain-value StoreModel state that snapshots hold and the journal replays into.
+struct StoreState: Equatable, Sendable {
+    var wishlist: Set<String> = []
+    var acquired: [String: Int] = [:]
+    /// Oldest first, so placing an order is an append.
+    private(set) var orders: [OrderRecord] = []
+    private var orderIndex: [UUID: Int] = [:]
+
+    init() {}
+
+    init(wishlist: Set<String>, acquired: [String: Int], orders: [OrderRecord]) {
+        self.wishlist = wishlist
+        self.acquired = acquired
+        self.orders = orders
+        orderIndex.reserveCapacity(orders.count)
+        for (i, order) in orders.enumerated() {
+            orderIndex[order.id] = i
+        }
+    }
+
+    mutating func apply(_ mutation: StoreMutation) {
+        switch mutation {
+        case .wishlistAdd(let key):
+            wishlist.insert(key)
+        case .wishlistRemove(let key):
+            wishlist.remove(key)
+        case let .orderPlaced(id, key, date):
+            guard orderIndex[id] == nil else { return }
+            acquired[key, default: 0] += 1
+            orderIndex[id] = orders.count
+            orders.append(OrderRecord(id: id, key: key, date: date, status: .processing))
+        case let .statusAdvanced(id, status):
+            if let i = orderIndex[id] {
+                orders[i].status = status
+            }
+        }
+    }
+}
+
+// MARK: - Journal
+
+/// Append-only persistence for StoreModel.
+///
+/// Layout in `directory`:
+/// - `snapshot.bin`: compact binary `StoreState` plus the sequence number it covers (see `StoreSnapshotCodec`).
+/// - `journal.jsonl`: one `{"seq":…,"m":…}` line per mutation after that snapshot.
+///
+/// `record` is cheap and callable from any thread: it queues the entry and a serial background queue
+/// writes the whole batch after `flushDelay`, so bursts of wishlist taps cost one write.
+/// Every `compactionThreshold` entries the journal is folded into a new snapshot and truncated.
+/// A torn last line (crash mid-write) is dropped on load, a corrupt line elsewhere is skipped; entries already covered by the
+/// snapshot (crash between snapshot and truncate) are skipped by sequence number.
+final class StoreJournal: @unchecked Sendable {
+
+    static let shared = StoreJournal(directory: defaultDirectory)
+
+    static var defaultDirectory: URL {
+        let base = FileManager.default.urls(for: .applicationSupportDirectory, in: .userDomainMask).first
+            ?? FileManager.default.temporaryDirectory
+        return base.appendingPathComponent("Aquire/StoreJournal", isDirectory: true)
+    }
+
+    private struct Entry: Codable {
+        let seq: UInt64
+        let m: StoreMutation
+    }
+
+    let directory: URL
+    let flushDelay: TimeInterval
+    let compactionThreshold: Int
+
+    var snapshotURL: URL { directory.appendingPathComponent("snapshot.bin") }
+    var journalURL: URL { directory.appendingPathComponent("journal.jsonl") }
+
+    // Guarded by `lock`; `record` touches these from any thread.
+    private let lock = NSLock()
+    private var pending: [Entry] = []
+    private var nextSequence: UInt64 = 1
+    private var flushScheduled = false
+
+    // Owned by `queue`.
+    private let queue = DispatchQueue(label: "aquire.store-journal", qos: .utility)
+    private var state = StoreState()
+    private var appliedSequence: UInt64 = 0
+    private var entriesSinceSnapshot = 0
+    private var handle: FileHandle?
+    private var loaded = false
+
+    init(directory: URL, flushDelay: TimeInterval = 0.25, compactionThreshold: Int = 512) {
+        self.directory = directory
+        self.flushDelay = flushDelay
+        self.compactionThreshold = compactionThreshold
+    }
+
+    // MARK: - Public API
+
+    /// Reads snapshot + journal and returns the recovered state. Only the first call touches disk.
+    func load() -> StoreState {
+        queue.sync { loadOnQueue() }
+    }
+
+    /// Queues a mutation. Never blocks on I/O.
+    func record(_ mutation: StoreMutation) {
+        lock.lock()
+        pending.append(Entry(seq: nextSequence, m: mutation))
+        nextSequence += 1
+        let schedule = !flushScheduled
+        flushScheduled = true
+        lock.unlock()
+
+        if schedule {
+            queue.asyncAfter(deadline: .now() + flushDelay) { [self] in
+                drain()
+            }
+        }
+    }
+
+    /// Queues several mutations under one lock, e.g. a bulk status transition.
+    func record<S: Sequence>(contentsOf mutations: S) where S.Element == StoreMutation {
+        lock.lock()
+        let before = pending.count
+        for mutation in mutations {
+            pending.append(Entry(seq: nextSequence, m: mutation))
+            nextSequence += 1
+        }
+        let added = pending.count > before
+        let schedule = added && !flushScheduled
+        if added { flushScheduled = true }
+        lock.unlock()
+
+        if schedule {
+            queue.asyncAfter(deadline: .now() + flushDelay) { [self] in
+                drain()
+            }
+        }
+    }
+
+    /// Writes everything queued so far before returning (e.g. when the app backgrounds).
+    func flush() {
+        queue.sync { drain() }
+    }
+
+    /// Flushes, then folds the journal into a fresh snapshot.
+    func compact() {
+        queue.sync {
+            drain()
+            compactOnQueue()
+        }
+    }
+
+    // MARK: - Queue work
+
+    private func loadOnQueue() -> StoreState {
+        if loaded { return state }
+        loaded = true
+        try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+
+        if let data = try? Data(contentsOf: snapshotURL, options: .alwaysMapped),
+           let snapshot = StoreSnapshotCodec.decode(data) {
+            state = snapshot.state
+            appliedSequence = snapshot.sequence
+        }
+
+        var validLength = 0
+        if let data = try? Data(contentsOf: journalURL, options: .alwaysMapped) {
+            let decoder = JSONDecoder()
+            var start = data.startIndex
+            while let newline = data[start...].firstIndex(of: 0x0A) {
+                // A complete but undecodable line is skipped, not treated as the end: everything
+                // after it is still valid. Only an unterminated last line is a torn write.
+                if let entry = try? decoder.decode(Entry.self, from: data[start..<newline]),
+                   entry.seq > appliedSequence {
+                    state.apply(entry.m)
+                    appliedSequence = entry.seq
+                    entriesSinceSnapshot += 1
+                }
+                start = newline + 1
+                validLength = start - data.startIndex
+            }
+        }
+
+        // Drop a torn tail (no trailing newline) so the next append starts on a clean line.
+        if let h = try? openHandle() {
+            try? h.truncate(atOffset: UInt64(validLength))
+        }
+
+        // Anything recorded before load gets renumbered after what's on disk.
+        lock.lock()
+        pending = pending.enumerated().map { i, e in Entry(seq: appliedSequence + 1 + UInt64(i), m: e.m) }
+        nextSequence = appliedSequence + 1 + UInt64(pending.count)
+        lock.unlock()
+
+        return state
+    }
+
+    private func drain() {
+        // Load first so anything recorded early is renumbered before we take it.
+        if !loaded { _ = loadOnQueue() }
+
+        lock.lock()
+        let batch = pending
+        pending.removeAll(keepingCapacity: true)
+        flushScheduled = false
+        lock.unlock()
+
+        guard !batch.isEmpty else { return }
+
+        let encoder = JSONEncoder()
+        var data = Data()
+        for entry in batch {
+            guard let line = try? encoder.encode(entry) else { continue }
+            data.append(line)
+            data.append(0x0A)
+            state.apply(entry.m)
+            appliedSequence = entry.seq
+        }
+
+        do {
+            let h = try openHandle()
+            try h.seekToEnd()
+            try h.write(contentsOf: data)
+            try h.synchronize()
+        } catch {
+            // State is still in memory; the next snapshot will persist it.
+        }
+
+        entriesSinceSnapshot += batch.count
+        if entriesSinceSnapshot >= compactionThreshold {
+            compactOnQueue()
+        }
+    }
+
+    private func compactOnQueue() {
+        if !loaded { _ = loadOnQueue() }
+        let data = StoreSnapshotCodec.encode(state, sequence: appliedSequence)
+        do {
+            try data.write(to: snapshotURL, options: .atomic)
+            try openHandle().truncate(atOffset: 0)
+            entriesSinceSnapshot = 0
+        } catch {
+            // Journal is still intact; try again at the next threshold.
+        }
+    }
+
+    private func openHandle() throws -> FileHandle {
+        if let handle { return handle }
+        if !FileManager.default.fileExists(atPath: journalURL.path) {
+            FileManager.default.createFile(atPath: journalURL.path, contents: nil)
+        }
+        let h = try FileHandle(forWritingTo: journalURL)
+        handle = h
+        return h
+    }
+}
+
+// MARK: - Snapshot codec
+
+/// Binary snapshot format (little-endian), designed to decode straight out of a mapped file:
+///
+///     "AQS1" | u64 sequence
+///     u32 keyCount      | keyCount × (u32 byteCount, UTF-8 bytes)
+///     u32 wishlistCount | wishlistCount × u32 keyIndex
+///     u32 acquiredCount | acquiredCount × (u32 keyIndex, i64 count)
+///     u32 orderCount    | orderCount × (u32 keyIndex, 16-byte UUID, f64 date, u8 status)
+///
+/// Catalog keys are interned once, so each order row is a fixed 29 bytes.
+/// Status bytes are `OrderStatus.code`.
+enum StoreSnapshotCodec {
+
+    private static let magic: [UInt8] = Array("AQS1".utf8)
+
+    static func encode(_ state: StoreState, sequence: UInt64) -> Data {
+        var keyIDs: [String: UInt32] = [:]
+        var keys: [String] = []
+        func intern(_ key: String) -> UInt32 {
+            if let id = keyIDs[key] { return id }
+            let id = UInt32(keys.count)
+            keyIDs[key] = id
+            keys.append(key)
+            return id
+        }
+        let wishlist = state.wishlist.sorted().map(intern)
+        let acquired = state.acquired.sorted(by: { $0.key < $1.key }).map { (intern($0.key), $0.value) }
+        let orderKeys = state.orders.map { intern($0.key) }
+
+        var out = Data()
+        out.reserveCapacity(64 + keys.count * 24 + state.orders.count * 29)
+
+        func put<T: FixedWidthInteger>(_ value: T) {
+            withUnsafeBytes(of: value.littleEndian) { out.append(contentsOf: $0) }
+        }
+
+        out.append(contentsOf: magic)
+        put(sequence)
+
+        put(UInt32(keys.count))
+        for key in keys {
+            let utf8 = Array(key.utf8)
+            put(UInt32(utf8.count))
+            out.append(contentsOf: utf8)
+        }
+
+        put(UInt32(wishlist.count))
+        for id in wishlist { put(id) }
+
+        put(UInt32(acquired.count))
+        for (id, count) in acquired {
+            put(id)
+            put(Int64(count))
+        }
+
+        put(UInt32(state.orders.count))
+        for (order, keyID) in zip(state.orders, orderKeys) {
+            put(keyID)
+            withUnsafeBytes(of: order.id.uuid) { out.append(contentsOf: $0) }
+            put(order.date.timeIntervalSinceReferenceDate.bitPattern)
+            put(order.status.code)
+        }
+        return out
+    }
+
+    /// Returns nil for anything truncated or not in this format.
+    static func decode(_ data: Data) -> (state: StoreState, sequence: UInt64)? {
+        data.withUnsafeBytes { raw -> (state: StoreState, sequence: UInt64)? in
+            var r = ByteReader(bytes: raw)
+            guard let head = r.bytes(magic.count), head.elementsEqual(magic),
+                  let sequence = r.read(UInt64.self),
+                  let keyCount = r.read(UInt32.self) else { return nil }
+
+            var keys: [String] = []
+            keys.reserveCapacity(Int(keyCount))
+            for _ in 0..<keyCount {
+                guard let n = r.read(UInt32.self), let utf8 = r.bytes(Int(n)) else { return nil }
+                keys.append(String(decoding: utf8, as: UTF8.self))
+            }
+            func key(_ id: UInt32?) -> String? {
+                guard let id, Int(id) < keys.count else { return nil }
+                return keys[Int(id)]
+            }
+
+            guard let wishlistCount = r.read(UInt32.self) else { return nil }
+            var wishlist = Set<String>(minimumCapacity: Int(wishlistCount))
+            for _ in 0..<wishlistCount {
+                guard let k = key(r.read(UInt32.self)) else { return nil }
+                wishlist.insert(k)
+            }
+
+            guard let acquiredCount = r.read(UInt32.self) else { return nil }
+            var acquired: [String: Int] = [:]
+            acquired.reserveCapacity(Int(acquiredCount))
+            for _ in 0..<acquiredCount {
+                guard let k = key(r.read(UInt32.self)), let count = r.read(Int64.self) else { return nil }
+                acquired[k] = Int(count)
+            }
+
+            guard let orderCount = r.read(UInt32.self) else { return nil }
+            var orders: [OrderRecord] = []
+            orders.reserveCapacity(Int(orderCount))
+            for _ in 0..<orderCount {
+                guard let k = key(r.read(UInt32.self)),
+                      let uuid = r.bytes(16)?.loadUnaligned(as: uuid_t.self),
+                      let bits = r.read(UInt64.self),
+                      let code = r.read(UInt8.self),
+                      let status = OrderStatus(code: code) else { return nil }
+                orders.append(OrderRecord(
+                    id: UUID(uuid: uuid),
+                    key: k,
+                    date: Date(timeIntervalSinceReferenceDate: Double(bitPattern: bits)),
+                    status: status
+                ))
+            }
+
+            return (StoreState(wishlist: wishlist, acquired: acquired, orders: orders), sequence)
+        }
+    }
+
+}
+
+/// Bounds-checked little-endian cursor over raw bytes.
+private struct ByteReader {
+    let raw: UnsafeRawBufferPointer
+    var offset = 0
+
+    init(bytes: UnsafeRawBufferPointer) {
+        raw = bytes
+    }
+
+    mutating func read<T: FixedWidthInteger>(_: T.Type) -> T? {
+        let size = MemoryLayout<T>.size
+        guard offset + size <= raw.count else { return nil }
+        let value = raw.loadUnaligned(fromByteOffset: offset, as: T.self)
+        offset += size
+        return T(littleEndian: value)
+    }
+
+    mutating func bytes(_ count: Int) -> UnsafeRawBufferPointer? {
+        guard count >= 0, offset + count <= raw.count else { return nil }
+        defer { offset += count }
+        return UnsafeRawBufferPointer(rebasing: raw[offset..<(offset + count)])
+    }
+}
@@ -13,25 +13,87 @@ final class StoreModel: ObservableObject {
 
     @Published var wishlist: Set<String> = []
     @Published var acquired: [String: Int] = [:]
-    @Published var orders: [Order] = []
 
-    init() {}
+    /// Columnar order history (oldest first). Read-only for views; mutate through StoreModel
+    /// so every change is journaled and published once.
+    let orderHistory = OrderHistory()
+
+    var orderCount: Int { orderHistory.count }
+
+    /// Persists every mutation; nil keeps the model in-memory only (previews).
+    private let journal: StoreJournal?
+
+    /// Mutations made before the journal finished loading; nil once it has.
+    private var unjournaled: [StoreMutation]? = []
+
+    /// Starts empty and fills in when the journal has been read off the main actor, so a large
+    /// order history never blocks the first frame.
+    init(journal: StoreJournal? = .shared) {
+        self.journal = journal
+        guard let journal else {
+            unjournaled = nil
+            return
+        }
+        Task.detached(priority: .userInitiated) { [weak self] in
+            let state = await TelemetryRecorder.shared.measure("store_load", source: "journal") { journal.load() }
+            await self?.finishLoading(state)
+        }
+    }
+
+    /// Publishes the loaded state with any early mutations replayed on top, then journals them.
+    private func finishLoading(_ loaded: StoreState) {
+        var state = loaded
+        let early = unjournaled ?? []
+        for mutation in early {
+            state.apply(mutation)
+        }
+        unjournaled = nil
+
+        objectWillChange.send()
+        wishlist = state.wishlist
+        acquired = state.acquired
+
+        orderHistory.removeAll()
+        orderHistory.reserveCapacity(state.orders.count)
+        for record in state.orders {
+            guard let productID = ProductCatalog.store.id(for: record.key) else { continue }
+            orderHistory.append(id: record.id, productID: productID, date: record.date, status: record.status)
+        }
+
+        journal?.record(contentsOf: early)
+    }
+
+    private func record(_ mutation: StoreMutation) {
+        record(contentsOf: [mutation])
+    }
+
+    private func record(contentsOf mutations: [StoreMutation]) {
+        if unjournaled != nil {
+            unjournaled?.append(contentsOf: mutations)
+        } else {
+            journal?.record(contentsOf: mutations)
+        }
+    }
 
     // MARK: - Wishlist
 
     func addToWishlist(_ key: String) {
-        wishlist.insert(key)
+        if wishlist.insert(key).inserted {
+            record(.wishlistAdd(key: key))
+        }
     }
 
     func removeFromWishlist(_ key: String) {
-        wishlist.remove(key)
+        if wishlist.remove(key) != nil {
+            record(.wishlistRemove(key: key))
+        }
     }
 
     func toggleWishlist(_ key: String) {
         if wishlist.contains(key) {
-            wishlist.remove(key)
+            removeFromWishlist(key)
         } else {
-            wishlist.insert(key)
+            addToWishlist(key)
         }
     }
 
@@ -42,15 +104,63 @@ final class StoreModel: ObservableObject {
     // MARK: - Purchasing
 
     func placeOrder(for key: String) {
+        let id = UUID()
+        let date = Date()
         acquired[key, default: 0] += 1
+        record(.orderPlaced(id: id, key: key, date: date))
 
-        if let product = ProductCatalog.product(for: key) {
-            let order = Order(product: product, date: Date(), status: .processing)
-            orders.insert(order, at: 0)
+        if let productID = ProductCatalog.store.id(for: key) {
+            objectWillChange.send()
+            orderHistory.append(id: id, productID: productID, date: date)
         }
     }
 
     func acquiredCount(for key: String) -> Int {
         acquired[key, default: 0]
     }
+
+    // MARK: - Orders
+
+    /// Up to `limit` orders older than `cursor`, newest first, with products resolved.
+    func orderPage(before cursor: OrderCursor? = nil, limit: Int = 50) -> (orders: [Order], next: OrderCursor?) {
+        let page = orderHistory.page(before: cursor, limit: limit)
+        let orders = page.rows.map { row in
+            Order(id: row.id, product: ProductCatalog.store.product(at: row.productID), date: row.date, status: row.status)
+        }
+        return (orders, page.next)
+    }
+
+    /// Moves an order to its next status. Returns false if unknown or already delivered.
+    @discardableResult
+    func advanceStatus(of orderID: UUID) -> Bool {
+        advanceStatuses(of: [orderID]) > 0
+    }
+
+    /// Advances many orders in one pass with a single change notification. Returns how many moved.
+    @discardableResult
+    func advanceStatuses<S: Sequence>(of orderIDs: S) -> Int where S.Element == UUID {
+        // Check first so a no-op (unknown or delivered orders) doesn't re-render every observer.
+        let ids = Array(orderIDs)
+        guard orderHistory.canAdvance(any: ids) else { return 0 }
+        objectWillChange.send()
+        return commit(orderHistory.advance(ids))
+    }
+
+    /// Advances every order currently in `status` one step. Returns how many moved.
+    @discardableResult
+    func advanceAll(from status: OrderStatus) -> Int {
+        guard orderHistory.canAdvanceAll(from: status) else { return 0 }
+        objectWillChange.send()
+        return commit(orderHistory.advanceAll(from: status))
+    }
+
+    private func commit(_ changes: [OrderStatusChange]) -> Int {
+        record(contentsOf: changes.map { StoreMutation.statusAdvanced(id: $0.id, status: $0.status) })
+        return changes.count
+    }
+
+    /// Pushes queued journal writes to disk now (call when the app backgrounds).
+    func flushPersistence() {
+        journal?.flush()
+    }
 }
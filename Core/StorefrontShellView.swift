@@ -8,6 +8,8 @@ import SwiftUI
 struct StorefrontShellView: View {
     @EnvironmentObject private var store: StoreModel
     @EnvironmentObject private var router: StorefrontRouter
+    @EnvironmentObject private var performance: PerformanceProfile
+    @Environment(\.scenePhase) private var scenePhase
 
     var body: some View {
         TabView(selection: $router.route) {
@@ -32,7 +34,7 @@ struct StorefrontShellView: View {
                     .tabItem { Label("Acquired", systemImage: "checkmark.seal") }
             }
 
-            if !store.orders.isEmpty {
+            if store.orderCount > 0 {
                 OrdersView()
                     .tag(StorefrontRoute.orders)
                     .tabItem { Label("Orders", systemImage: "shippingbox") }
@@ -42,5 +44,15 @@ struct StorefrontShellView: View {
                 .tag(StorefrontRoute.settings)
                 .tabItem { Label("Settings", systemImage: "gearshape") }
         }
+        // Warmup is sized for the tier at launch and stops starting new work once the user
+        // touches the screen, so it never competes with the first real interaction. Route changes
+        // aren't counted: programmatic navigation isn't the user.
+        .task { StartupWarmup.run(tier: performance.tier) }
+        .simultaneousGesture(TapGesture().onEnded { StartupWarmup.userDidInteract() })
+        .simultaneousGesture(DragGesture(minimumDistance: 10).onChanged { _ in StartupWarmup.userDidInteract() })
+        .onChange(of: scenePhase) { phase in
+            // Journal writes are batched; don't leave a batch pending if we get suspended.
+            if phase == .background { store.flushPersistence() }
+        }
     }
 }
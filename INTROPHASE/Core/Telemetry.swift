@@ -6,22 +6,97 @@
 import Foundation
 import SwiftUI
 
+/// SwiftUI face of `TelemetryRecorder`. Logging goes straight to the ring from any thread and
+/// never invalidates a view. `snapshot` only changes on `sample()`, or every `sampleInterval`
+/// between `startSampling()` and `stopSampling()`, so the many views that hold this object just
+/// to log don't re-render while nobody is looking at the numbers.
 @MainActor
 final class Telemetry: ObservableObject {
 
-    @Published private(set) var events: [TelemetryEvent] = []
+    nonisolated let recorder: TelemetryRecorder
 
-    func log(_ message: String, source: String = "app") {
-        events.insert(TelemetryEvent(message: message, source: source, date: Date()), at: 0)
+    @Published private(set) var snapshot = TelemetrySnapshot()
+
+    private let sampleInterval: TimeInterval
+    private var sampler: Task<Void, Never>?
+
+    init(recorder: TelemetryRecorder = .shared, sampleInterval: TimeInterval = 1.0) {
+        self.recorder = recorder
+        self.sampleInterval = sampleInterval
+    }
+
+    deinit {
+        sampler?.cancel()
+    }
+
+    /// Plain events from the latest sample, newest first.
+    var events: [TelemetryEvent] {
+        let nowUptime = TelemetryRecorder.now()
+        let now = Date()
+        return snapshot.recent.compactMap { record in
+            guard record.kind == .event else { return nil }
+            let age = TimeInterval(nowUptime &- record.timestamp) / 1_000_000_000
+            return TelemetryEvent(id: record.sequence, message: record.name, source: record.source, date: now.addingTimeInterval(-age))
+        }
+    }
+
+    nonisolated func log(_ message: String, source: String = "app") {
+        recorder.log(message, source: source)
+    }
+
+    nonisolated func begin(_ name: String, source: String = "app") -> TelemetrySpan {
+        recorder.begin(name, source: source)
+    }
+
+    nonisolated func end(_ span: TelemetrySpan) {
+        recorder.end(span)
+    }
+
+    /// Re-samples every `sampleInterval` until `stopSampling()`; for on-screen diagnostics.
+    func startSampling() {
+        sample()
+        guard sampler == nil else { return }
+        let interval = UInt64(sampleInterval * 1_000_000_000)
+        sampler = Task { [weak self] in
+            while !Task.isCancelled {
+                try? await Task.sleep(nanoseconds: interval)
+                self?.sample()
+            }
+        }
+    }
+
+    func stopSampling() {
+        sampler?.cancel()
+        sampler = nil
+    }
+
+    /// Pulls a fresh snapshot now.
+    func sample() {
+        let next = recorder.snapshot()
+        guard next.recorded != snapshot.recorded || next.dropped != snapshot.dropped else { return }
+        snapshot = next
     }
 
     func clear() {
-        events.removeAll()
+        recorder.clear()
+        snapshot = recorder.snapshot()
+    }
+
+    /// Writes the ring's records to Caches/Aquire/Telemetry and returns the file.
+    func export(_ format: TelemetryExportFormat = .jsonLines) throws -> URL {
+        let caches = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first
+            ?? FileManager.default.temporaryDirectory
+        let dir = caches.appendingPathComponent("Aquire/Telemetry", isDirectory: true)
+        try FileManager.default.createDirectory(at: dir, withIntermediateDirectories: true)
+        let ext = format == .jsonLines ? "jsonl" : "bin"
+        let url = dir.appendingPathComponent("telemetry-\(Int(Date().timeIntervalSince1970)).\(ext)")
+        try recorder.export(format).write(to: url, options: .atomic)
+        return url
     }
 }
 
 struct TelemetryEvent: Identifiable, Hashable {
-    let id = UUID()
+    let id: Int
     let message: String
     let source: String
     let date: Date
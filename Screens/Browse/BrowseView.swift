@@ -3,14 +3,22 @@ import SwiftUI
 struct BrowseView: View {
     let products: [Product]
     @State private var searchText: String = ""
+    @State private var results: [Product]? = nil
+    @State private var search = ProductSearchSession(index: ProductCatalog.searchIndex)
 
+    /// Most results a query shows; ranking stops there instead of ordering every match.
+    private static let resultLimit = 60
+
+    /// `nil` results means no active query; the search runs off-main in `.task(id:)`.
+    /// A product matches when every query word is a prefix of a word in its name, category or
+    /// description (not an arbitrary substring), and results stay within `products`.
     private var filtered: [Product] {
-        let q = searchText.trimmingCharacters(in: .whitespacesAndNewlines).lowercased()
-        guard !q.isEmpty else { return products }
-        return products.filter {
-            $0.name.lowercased().contains(q) ||
-            $0.category.lowercased().contains(q)
-        }
+        results ?? products
+    }
+
+    /// Reruns the search when either the query or the product list changes.
+    private var searchScope: SearchScope {
+        SearchScope(query: searchText, productIDs: products.map(\.id))
     }
 
     var body: some View {
@@ -45,9 +53,30 @@ struct BrowseView: View {
             .padding(16)
         }
         .background(AquireBackdrop().ignoresSafeArea())
+        .task(id: searchScope) {
+            // A new query or product list cancels the previous task, so stale results never land.
+            let query = searchText
+            guard !query.trimmingCharacters(in: .whitespacesAndNewlines).isEmpty else {
+                results = nil
+                await search.reset()
+                return
+            }
+            // The index covers the whole catalog; rank only among what this view was given.
+            let allowed = Set(products.compactMap { ProductCatalog.store.id(for: $0) })
+            if let found = try? await search.search(query, limit: Self.resultLimit, within: allowed) {
+                // The actor may finish after this task was cancelled; a newer query owns `results`.
+                guard !Task.isCancelled else { return }
+                results = found
+            }
+        }
     }
 }
 
+private struct SearchScope: Hashable {
+    let query: String
+    let productIDs: [UUID]
+}
+
 private struct CatalogCard: View {
     let product: Product
 
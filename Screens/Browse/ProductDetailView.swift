@@ -9,6 +9,8 @@ struct ProductDetailView: View {
     @Environment(\.dismiss) private var dismiss
     
     @State private var isUpdatingFirmware = false
+    @State private var summary: String? = nil
+    @ObservedObject private var summaryUpdates = AIService.shared.updates
     
     private var productKey: String? { ProductCatalog.key(for: product) }
     
@@ -117,10 +119,34 @@ struct ProductDetailView: View {
                         }
                     }
                     
+                    if let summary {
+                        AquireSurface {
+                            VStack(alignment: .leading, spacing: 10) {
+                                Text("Summary")
+                                    .font(.system(size: 14, weight: .bold, design: .rounded))
+                                    .foregroundColor(.white.opacity(0.9))
+                                
+                                Text(summary)
+                                    .font(.system(size: 13, weight: .regular, design: .rounded))
+                                    .foregroundColor(.white.opacity(0.72))
+                            }
+                        }
+                    }
+                    
                     Spacer(minLength: 8)
                 }
                 .padding(18)
             }
         }
+        .task(id: SummaryLookup(productID: product.id, revision: summaryUpdates.revision)) {
+            // Cache only: warmup generates summaries, and each finished pass bumps `revision`,
+            // which reruns this lookup.
+            summary = AIService.shared.cachedSummary(for: product)
+        }
     }
 }
+
+private struct SummaryLookup: Hashable {
+    let productID: UUID
+    let revision: Int
+}
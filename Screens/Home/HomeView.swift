@@ -52,12 +52,12 @@ struct HomeView: View {
 
                     AquireStatTile(title: "Wishlist", value: "\(store.wishlist.count)", systemImage: "bookmark")
                     AquireStatTile(title: "Acquired", value: "\(store.acquired.count)", systemImage: "checkmark.seal")
-                    AquireStatTile(title: "Orders", value: "\(store.orders.count)", systemImage: "shippingbox")
+                    AquireStatTile(title: "Orders", value: "\(store.orderCount)", systemImage: "shippingbox")
                     AquireStatTile(title: "Tier", value: performance.tier.rawValue.capitalized, systemImage: "gauge.with.dots.needle.50percent")
                 }
                 .animation(allowMotion ? .easeOut(duration: 0.25) : nil, value: store.wishlist.count)
                 .animation(allowMotion ? .easeOut(duration: 0.25) : nil, value: store.acquired.count)
-                .animation(allowMotion ? .easeOut(duration: 0.25) : nil, value: store.orders.count)
+                .animation(allowMotion ? .easeOut(duration: 0.25) : nil, value: store.orderCount)
 
                 // Quick Actions
                 AquireSurface(cornerRadius: 24, padding: 14) {
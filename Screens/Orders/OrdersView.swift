@@ -8,10 +8,51 @@ import SwiftUI
 struct OrdersView: View {
     @EnvironmentObject private var store: StoreModel
 
+    private static let pageSize = 50
+
+    /// Rows loaded so far, newest first, and where the next (older) page starts.
+    /// Each page is read once; scrolling to the end appends one more.
+    @State private var loaded: [Order] = []
+    @State private var next: OrderCursor?
+
+    private func loadFirstPage() {
+        let page = store.orderPage(limit: Self.pageSize)
+        loaded = page.orders
+        next = page.next
+    }
+
+    private func loadNextPage() {
+        guard let cursor = next else { return }
+        let page = store.orderPage(before: cursor, limit: Self.pageSize)
+        loaded += page.orders
+        next = page.next
+    }
+
+    /// New orders land on top. Prepend them when they sit right above what's loaded; anything
+    /// else (the history was reloaded from disk) starts over from the newest page.
+    private func orderCountChanged(from old: Int, to new: Int) {
+        let added = new - old
+        guard added > 0, added <= Self.pageSize, let newest = loaded.first else {
+            loadFirstPage()
+            return
+        }
+        let page = store.orderPage(limit: added + 1)
+        guard page.orders.last?.id == newest.id else {
+            loadFirstPage()
+            return
+        }
+        loaded.insert(contentsOf: page.orders.dropLast(), at: 0)
+    }
+
+    /// Loaded rows keep their product and date; status is read live, since it changes in place.
+    private func status(of order: Order) -> OrderStatus {
+        store.orderHistory.status(of: order.id) ?? order.status
+    }
+
     var body: some View {
         ScreenScaffold("Orders", subtitle: "Shipments and status updates.") {
 
-            if store.orders.isEmpty {
+            if store.orderCount == 0 {
                 AquireSurface {
                     Text("No orders yet.")
                         .font(.system(size: 14, weight: .semibold, design: .rounded))
@@ -20,7 +61,7 @@ struct OrdersView: View {
                 }
             } else {
                 LazyVStack(spacing: 12) {
-                    ForEach(store.orders) { order in
+                    ForEach(loaded) { order in
                         AquireSurface(cornerRadius: 26, padding: 16) {
                             HStack(alignment: .center, spacing: 12) {
                                 Image(systemName: order.product.imageSystemName)
@@ -39,12 +80,23 @@ struct OrdersView: View {
 
                                 Spacer()
 
-                                StatusPill(text: order.status.rawValue, color: Color.white)
+                                StatusPill(text: status(of: order).rawValue, color: Color.white)
+                            }
+                        }
+                        .onAppear {
+                            if order.id == loaded.last?.id {
+                                loadNextPage()
                             }
                         }
                     }
                 }
             }
         }
+        .onAppear {
+            if loaded.isEmpty { loadFirstPage() }
+        }
+        .onChange(of: store.orderCount) { old, new in
+            orderCountChanged(from: old, to: new)
+        }
     }
 }
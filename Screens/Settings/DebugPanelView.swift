@@ -4,6 +4,19 @@ struct DebugPanelView: View {
     @EnvironmentObject private var store: StoreModel
     @EnvironmentObject private var telemetry: Telemetry
 
+    @State private var exportPath: String? = nil
+
+    private struct SpanRow: Identifiable {
+        let name: String
+        let histogram: LatencyHistogram
+        var id: String { name }
+    }
+
+    private var slowestSpans: [SpanRow] {
+        let rows = telemetry.snapshot.histograms.map { SpanRow(name: $0.key, histogram: $0.value) }
+        return Array(rows.sorted { $0.histogram.percentileMs(0.95) > $1.histogram.percentileMs(0.95) }.prefix(6))
+    }
+
     var body: some View {
         ScrollView {
             VStack(alignment: .leading, spacing: 14) {
@@ -35,13 +48,59 @@ struct DebugPanelView: View {
                             Text("Orders")
                                 .foregroundColor(.white.opacity(0.7))
                             Spacer()
-                            Text("\(store.orders.count)")
+                            Text("\(store.orderCount)")
                                 .foregroundColor(.white.opacity(0.9))
                         }
                     }
                     .font(.system(size: 13, weight: .regular, design: .rounded))
                 }
 
+                AquireSurface {
+                    VStack(alignment: .leading, spacing: 10) {
+                        Text("Telemetry")
+                            .font(.system(size: 14, weight: .bold, design: .rounded))
+                            .foregroundColor(.white.opacity(0.9))
+
+                        HStack {
+                            Text("Recorded")
+                                .foregroundColor(.white.opacity(0.7))
+                            Spacer()
+                            Text("\(telemetry.snapshot.recorded) (\(telemetry.snapshot.dropped) dropped)")
+                                .foregroundColor(.white.opacity(0.9))
+                        }
+
+                        // Slowest spans first; sampled about once a second while this is on screen.
+                        ForEach(slowestSpans) { span in
+                            HStack {
+                                Text(span.name)
+                                    .foregroundColor(.white.opacity(0.7))
+                                Spacer()
+                                Text(String(format: "%d× p50 %.1f / p95 %.1f ms",
+                                            span.histogram.count,
+                                            span.histogram.percentileMs(0.5),
+                                            span.histogram.percentileMs(0.95)))
+                                    .foregroundColor(.white.opacity(0.9))
+                            }
+                        }
+
+                        Button {
+                            exportPath = (try? telemetry.export(.jsonLines))?.lastPathComponent ?? "Export failed"
+                        } label: {
+                            Text("Export JSON Lines")
+                                .font(.system(size: 13, weight: .bold, design: .rounded))
+                                .foregroundColor(.white)
+                        }
+                        .buttonStyle(.plain)
+
+                        if let exportPath {
+                            Text(exportPath)
+                                .font(.system(size: 11, weight: .regular, design: .monospaced))
+                                .foregroundColor(.white.opacity(0.55))
+                        }
+                    }
+                    .font(.system(size: 13, weight: .regular, design: .rounded))
+                }
+
                 AquireSurface {
                     VStack(alignment: .leading, spacing: 10) {
                         Text("Note")
@@ -57,6 +116,12 @@ struct DebugPanelView: View {
             .padding(18)
         }
         .aquireBackground()
-        .onAppear { telemetry.log("screen_show", source: "DebugPanel") }
+        .onAppear {
+            telemetry.log("screen_show", source: "DebugPanel")
+            telemetry.startSampling()
+        }
+        .onDisappear {
+            telemetry.stopSampling()
+        }
     }
 }
@@ -1,7 +1,7 @@
 import SwiftUI
 
 /// Lightweight overlay for quick internal state checks.
-/// Safe with the new keyed StoreModel (wishlist: Set<String>, acquired: [String:Int], orders: [Order]).
+/// Safe with the new keyed StoreModel (wishlist: Set<String>, acquired: [String:Int], orderHistory: OrderHistory).
 struct DebugOverlay: View {
     @EnvironmentObject private var store: StoreModel
 
@@ -39,12 +39,24 @@ struct DebugOverlay: View {
                     HStack(spacing: 12) {
                         stat("Wishlist", value: store.wishlist.count)
                         stat("Acquired", value: store.acquired.count)
-                        stat("Orders", value: store.orders.count)
+                        stat("Orders", value: store.orderCount)
                     }
 
                     if expanded {
                         Divider().background(Color.white.opacity(0.15))
 
+                        #if canImport(UIKit)
+                        // Sampled once a second rather than observed, so cache traffic never invalidates views.
+                        TimelineView(.periodic(from: .now, by: 1.0)) { _ in
+                            let images = ImageCache.shared.stats
+                            HStack(spacing: 12) {
+                                stat("Img hit %", value: Int((images.hitRate * 100).rounded()))
+                                stat("Img loads", value: images.diskHits + images.misses)
+                                stat("Load ms", value: Int(images.averageLoadMs.rounded()))
+                            }
+                        }
+                        #endif
+
                         VStack(alignment: .leading, spacing: 6) {
                             Text("Acquired (keys)")
                                 .font(.system(size: 11, weight: .bold, design: .rounded))
@@ -92,12 +92,8 @@ struct ProductCard: View {
                     guard let thumb = product.thumbnailName else { return }
 
                     #if canImport(UIKit)
-                    await Task.detached {
-                        let ui = UIImage(named: thumb)
-                        await MainActor.run {
-                            thumbnailImage = ui
-                        }
-                    }.value
+                    // 120pt tall at up to 3x; decoded once, shared across cards and launches.
+                    thumbnailImage = await ImageCache.shared.loadImageAsync(named: thumb, maxPixelSize: 360)
                     #elseif canImport(AppKit)
                     await Task.detached {
                         let name = NSImage.Name(thumb)
@@ -160,6 +156,15 @@ struct ProductCard: View {
                         .clipShape(RoundedRectangle(cornerRadius: 18, style: .continuous))
                     }
                     .buttonStyle(.plain)
+                    .task {
+                        // Warm the scene the embedded preview opens, through the cache it reads.
+                        // Only cards that stay on screen a moment: a fast scroll cancels this
+                        // before it loads anything, so flinging a grid doesn't churn the cache.
+                        guard let modelName = product.modelName else { return }
+                        try? await Task.sleep(nanoseconds: 600_000_000)
+                        guard !Task.isCancelled else { return }
+                        SceneCache.shared.prefetch([modelName])
+                    }
                     .confirmationDialog("Preview Options", isPresented: $showPreviewOptions, titleVisibility: .visible) {
                         Button("Embedded Preview") { showingModel = true }
                         if quickLookURL != nil {
@@ -2,24 +2,63 @@ import Foundation
 
 /// Lightweight AI service scaffold.
 /// - Purpose: Provide a single place to plug in Apple Intelligence / FoundationModels in the future.
-/// - Current behavior: Synchronous heuristic summary (safe, no external dependencies). Replace implementation with FoundationModels calls when on-device models are available.
+/// - Current behavior: Heuristic summaries through `SummaryEngine`, memoized on disk and precomputed
+///   for the catalog during startup warmup. Swap the backend for a FoundationModels one when
+///   on-device models are available; keys include the backend identity, so nothing stale is served.
 final class AIService {
     static let shared = AIService()
-    private init() {}
 
-    /// Generate a short product summary. This default implementation is local and deterministic.
-    /// Replace the body of this method with an on-device FoundationModels call when you opt into the new SDK.
+    let summaries: SummaryEngine
+    /// Bumped after each precompute pass so views showing `cachedSummary` look again.
+    let updates = SummaryUpdates()
+
+    private init() {
+        let caches = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first
+            ?? FileManager.default.temporaryDirectory
+        summaries = SummaryEngine(
+            backend: HeuristicSummaryBackend(),
+            store: SummaryStore(fileURL: caches.appendingPathComponent("Aquire/Summaries/summaries.json")),
+            maxConcurrent: max(1, ProcessInfo.processInfo.activeProcessorCount / 2)
+        )
+    }
+
+    /// Precomputed summary, or nil if it hasn't been generated yet. Never generates; observe
+    /// `updates` to hear when more are stored.
+    func cachedSummary(for product: Product) -> String? {
+        summaries.cachedSummary(for: SummaryRequest(name: product.name, description: product.description))
+    }
+
+    /// Generate a short product summary, or reuse the stored one.
     func generateShortSummary(for name: String, description: String) async -> String {
-        // Fast heuristic: keep first sentence, append short features bullet.
-        let firstSentence = description.split(maxSplits: 1, omittingEmptySubsequences: true, whereSeparator: { $0 == "." || $0 == "!" || $0 == "?" }).first?.trimmingCharacters(in: .whitespacesAndNewlines) ?? description
+        let request = SummaryRequest(name: name, description: description)
+        if let summary = await summaries.summary(for: request) {
+            return summary
+        }
+        return HeuristicSummaryBackend.summary(name: name, description: description)
+    }
+
+    /// Summarizes every product not already stored, `maxConcurrent` at a time, then drops
+    /// summaries for products that changed or left the catalog.
+    @discardableResult
+    func precomputeSummaries(for products: [Product], maxConcurrent: Int? = nil) async -> SummaryBatchReport {
+        let requests = products.map { SummaryRequest(name: $0.name, description: $0.description) }
+        let report = await summaries.summarizeAll(requests, maxConcurrent: maxConcurrent)
+        summaries.store.retain(only: Set(requests.map(summaries.key(for:))))
+        summaries.store.flush()
+        await updates.didStore()
+        return report
+    }
+}
+
+/// Tells views that new summaries are in the store. They re-read `cachedSummary` when
+/// `revision` changes instead of generating their own.
+@MainActor
+final class SummaryUpdates: ObservableObject {
+    @Published private(set) var revision = 0
 
-        let features = [
-            "Compact, modern design",
-            "Optimized for Foundation ecosystems",
-            "Supports AR & 3D preview"
-        ]
+    nonisolated init() {}
 
-        let summary = "\(firstSentence).\n\nKey features:\n- \(features.joined(separator: "\n- "))"
-        return summary
+    func didStore() {
+        revision += 1
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,127 @@
+import Foundation
+
+/// Actor-owned LRU for heavy assets (scenes, model entities) that load asynchronously by key.
+///
+/// Storage is `LRUCostCache`, so get/put/evict are O(1). Each entry is charged by the `cost`
+/// function given at init (e.g. vertex + texture bytes), concurrent requests for one key share a
+/// single load, and `prefetch` warms keys before anyone asks for them.
+/// Foundation-only; the platform type only shows up through `Value` and the two closures.
+actor AsyncLRUCache<Key: Hashable & Sendable, Value> {
+
+    typealias Loader = @Sendable (Key) async throws -> Value?
+
+    nonisolated let counters = CacheCounters()
+
+    private var storage: LRUCostCache<Key, Value>
+    private let cost: @Sendable (Value) -> Int
+    private let loader: Loader
+    private var inFlight: [Key: Task<UncheckedSendable<Value?>, Never>] = [:]
+
+    init(
+        costLimit: Int = .max,
+        countLimit: Int = .max,
+        cost: @escaping @Sendable (Value) -> Int = { _ in 1 },
+        load: @escaping Loader
+    ) {
+        self.storage = LRUCostCache(costLimit: costLimit, countLimit: countLimit)
+        self.cost = cost
+        self.loader = load
+    }
+
+    var count: Int { storage.count }
+    var totalCost: Int { storage.totalCost }
+    var pendingCount: Int { inFlight.count }
+
+    func contains(_ key: Key) -> Bool {
+        storage.contains(key)
+    }
+
+    func isLoading(_ key: Key) -> Bool {
+        inFlight[key] != nil
+    }
+
+    /// Keys from most to least recently used.
+    var keysByRecency: [Key] { storage.keysByRecency }
+
+    // MARK: - Access
+
+    /// Memory-only lookup; counts a hit and marks the entry most recent when found.
+    func cachedValue(for key: Key) -> Value? {
+        let value = storage.value(forKey: key)
+        if value != nil { counters.memoryHit() }
+        return value
+    }
+
+    /// Cached value, or the result of one shared load however many callers ask at once.
+    /// A caller that joins a lower-priority prefetch escalates it by awaiting it.
+    func value(for key: Key, priority: TaskPriority? = .userInitiated) async -> Value? {
+        if let hit = cachedValue(for: key) { return hit }
+        if inFlight[key] != nil { counters.coalesced() }
+        return await load(key, priority: priority, prefetch: false).value.value
+    }
+
+    /// Starts background loads for keys that are neither cached nor loading, in the order given
+    /// (callers pass the most likely next key first). Returns how many loads were started.
+    @discardableResult
+    func prefetch(_ keys: [Key], priority: TaskPriority = .utility) -> Int {
+        var started = 0
+        for key in keys where !storage.contains(key) && inFlight[key] == nil {
+            load(key, priority: priority, prefetch: true)
+            started += 1
+        }
+        return started
+    }
+
+    // MARK: - Mutation
+
+    func insert(_ value: Value, for key: Key) {
+        let evicted = storage.insert(value, forKey: key, cost: cost(value))
+        counters.evicted(evicted.count)
+    }
+
+    @discardableResult
+    func removeValue(for key: Key) -> Value? {
+        storage.removeValue(forKey: key)
+    }
+
+    /// Drops every entry. Loads already in flight still land when they finish.
+    func removeAll() {
+        storage.removeAll()
+    }
+
+    func setLimits(cost: Int? = nil, count: Int? = nil) {
+        let evicted = storage.setLimits(cost: cost, count: count)
+        counters.evicted(evicted.count)
+    }
+
+    // MARK: - Loading
+
+    /// Returns the in-flight Task for `key`, starting one if needed. The load runs detached so
+    /// it never holds the actor; it inserts before it returns, so a later lookup that races with
+    /// the Task finishing still finds the value.
+    @discardableResult
+    private func load(_ key: Key, priority: TaskPriority?, prefetch: Bool) -> Task<UncheckedSendable<Value?>, Never> {
+        if let task = inFlight[key] { return task }
+        let loader = self.loader
+        let task = Task.detached(priority: priority) { [self] in
+            let start = DispatchTime.now().uptimeNanoseconds
+            let result = UncheckedSendable(value: try? await loader(key))
+            await finish(key, result, nanos: DispatchTime.now().uptimeNanoseconds - start, prefetch: prefetch)
+            return result
+        }
+        inFlight[key] = task
+        return task
+    }
+
+    private func finish(_ key: Key, _ result: UncheckedSendable<Value?>, nanos: UInt64, prefetch: Bool) {
+        inFlight[key] = nil
+        if let value = result.value {
+            insert(value, for: key)
+        }
+        if prefetch {
+            counters.prefetched()
+        } else {
+            counters.miss(nanos: nanos)
+        }
+    }
+}
@@ -0,0 +1,146 @@
+import Foundation
+
+/// Carries a non-Sendable value (UIImage, SCNScene, …) through an in-flight Task.
+/// Only use it where the value is handed over, not shared and mutated.
+struct UncheckedSendable<Value>: @unchecked Sendable {
+    let value: Value
+}
+
+/// Shares one in-flight load per key: the first caller starts it, later callers for the same
+/// key await the same Task instead of loading again.
+/// Loads run detached, so they never serialize on this actor.
+actor RequestCoalescer<Key: Hashable & Sendable, Value: Sendable> {
+
+    private var inFlight: [Key: Task<Value, Error>] = [:]
+
+    var pendingCount: Int { inFlight.count }
+
+    func isLoading(_ key: Key) -> Bool {
+        inFlight[key] != nil
+    }
+
+    /// `joined` is true when this caller piggybacked on someone else's load.
+    func run(
+        _ key: Key,
+        priority: TaskPriority? = nil,
+        _ load: @escaping @Sendable () async throws -> Value
+    ) async throws -> (value: Value, joined: Bool) {
+        if let task = inFlight[key] {
+            let value = try await task.value
+            return (value, true)
+        }
+        let task = Task.detached(priority: priority) { try await load() }
+        inFlight[key] = task
+        defer { inFlight[key] = nil }
+        let value = try await task.value
+        return (value, false)
+    }
+}
+
+// MARK: - Counters
+
+/// Point-in-time cache counters, e.g. for the debug overlay.
+struct CacheStats: Equatable, Sendable {
+    var memoryHits = 0
+    var diskHits = 0
+    var misses = 0
+    /// Requests that joined another caller's in-flight load.
+    var coalesced = 0
+    var evictions = 0
+    /// Background loads started ahead of use; not lookups, so they don't move `hitRate`.
+    var prefetches = 0
+    /// Time spent in disk reads and loads for `diskHits + misses`.
+    var loadNanos: UInt64 = 0
+
+    var lookups: Int { memoryHits + diskHits + misses + coalesced }
+
+    /// Fraction of lookups that didn't need a fresh load.
+    var hitRate: Double {
+        lookups == 0 ? 0 : Double(lookups - misses) / Double(lookups)
+    }
+
+    var averageLoadMs: Double {
+        let loads = diskHits + misses
+        return loads == 0 ? 0 : Double(loadNanos) / Double(loads) / 1_000_000
+    }
+}
+
+/// Lock-protected `CacheStats`, safe to bump from any thread.
+final class CacheCounters: @unchecked Sendable {
+
+    private let lock = NSLock()
+    private var stats = CacheStats()
+
+    var snapshot: CacheStats {
+        lock.lock()
+        defer { lock.unlock() }
+        return stats
+    }
+
+    func memoryHit() {
+        update { $0.memoryHits += 1 }
+    }
+
+    func coalesced() {
+        update { $0.coalesced += 1 }
+    }
+
+    func diskHit(nanos: UInt64) {
+        update {
+            $0.diskHits += 1
+            $0.loadNanos += nanos
+        }
+    }
+
+    func miss(nanos: UInt64) {
+        update {
+            $0.misses += 1
+            $0.loadNanos += nanos
+        }
+    }
+
+    func prefetched() {
+        update { $0.prefetches += 1 }
+    }
+
+    func evicted(_ n: Int) {
+        guard n > 0 else { return }
+        update { $0.evictions += n }
+    }
+
+    func reset() {
+        update { $0 = CacheStats() }
+    }
+
+    private func update(_ body: (inout CacheStats) -> Void) {
+        lock.lock()
+        body(&stats)
+        lock.unlock()
+    }
+}
+
+// MARK: - Hashing
+
+/// Stable, dependency-free 64-bit FNV-1a, used for cache keys (not security).
+enum ContentHash {
+
+    static func fnv1a64(_ data: Data) -> UInt64 {
+        data.withUnsafeBytes { raw in
+            var h: UInt64 = 0xCBF2_9CE4_8422_2325
+            for byte in raw {
+                h ^= UInt64(byte)
+                h = h &* 0x0000_0100_0000_01B3
+            }
+            return h
+        }
+    }
+
+    static func fnv1a64(_ string: String) -> UInt64 {
+        var h: UInt64 = 0xCBF2_9CE4_8422_2325
+        for byte in string.utf8 {
+            h ^= UInt64(byte)
+            h = h &* 0x0000_0100_0000_01B3
+        }
+        return h
+    }
+}
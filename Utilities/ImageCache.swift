@@ -1,37 +1,174 @@
 import UIKit
+import ImageIO
 
-/// Simple in-memory image cache with async loader for bundled assets.
-/// Uses NSCache to avoid unbounded growth and keeps a small API that's easy to use from SwiftUI .task.
+/// In-memory + on-disk image cache with async loader for bundled assets.
+/// Memory cost is the decoded bitmap size; concurrent loads of the same image share one decode;
+/// `maxPixelSize` downsamples at decode time and those thumbnails persist across launches.
+/// The policy lives in the platform-independent `ImagePipeline`; this file is the UIKit decoder.
 final class ImageCache {
     static let shared = ImageCache()
 
-    private let cache = NSCache<NSString, UIImage>()
+    private let pipeline: ImagePipeline<UIKitImageDecoder>
 
     private init() {
-        cache.countLimit = 128
-        cache.totalCostLimit = 50 * 1024 * 1024 // ~50MB default
+        let caches = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first
+            ?? FileManager.default.temporaryDirectory
+        pipeline = ImagePipeline(
+            decoder: UIKitImageDecoder(),
+            costLimit: 50 * 1024 * 1024, // ~50MB of decoded pixels
+            countLimit: 128,
+            disk: ThumbnailDiskCache(directory: caches.appendingPathComponent("Aquire/Thumbnails", isDirectory: true))
+        )
+
+        // NSCache used to drop itself under pressure; keep that behavior.
+        NotificationCenter.default.addObserver(
+            forName: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil,
+            queue: nil
+        ) { [pipeline] _ in
+            pipeline.removeAllFromMemory()
+        }
     }
 
     func image(forKey key: String) -> UIImage? {
-        cache.object(forKey: key as NSString)
+        pipeline.cachedImage(forKey: key)
     }
 
     func set(_ image: UIImage, forKey key: String) {
-        let cost = image.pngData()?.count ?? 0
-        cache.setObject(image, forKey: key as NSString, cost: cost)
+        pipeline.insert(image, cost: Self.decodedCost(of: image), forKey: key)
+    }
+
+    /// Asynchronously load a bundled image by name (or return cached). Pass `maxPixelSize`
+    /// (long edge, in pixels) for thumbnails so only that much is ever decoded.
+    func loadImageAsync(named name: String, maxPixelSize: Int? = nil) async -> UIImage? {
+        await pipeline.image(named: name, maxPixelSize: maxPixelSize, priority: .userInitiated)
+    }
+
+    /// Synchronous memory lookup for the same name+size `loadImageAsync` would use.
+    func cachedImage(named name: String, maxPixelSize: Int? = nil) -> UIImage? {
+        pipeline.cachedImage(forKey: ImagePipeline<UIKitImageDecoder>.memoryKey(name: name, maxPixelSize: maxPixelSize))
+    }
+
+    /// Hit-rate / latency counters for the debug overlay.
+    var stats: CacheStats { pipeline.counters.snapshot }
+
+    var memoryCost: Int { pipeline.memoryCost }
+
+    func removeAll() {
+        pipeline.removeAllFromMemory()
+        pipeline.disk?.removeAll()
+        pipeline.counters.reset()
+    }
+
+    /// Bytes the decoded bitmap occupies, without re-encoding anything.
+    static func decodedCost(of image: UIImage) -> Int {
+        if let cg = image.cgImage {
+            return cg.bytesPerRow * cg.height
+        }
+        let pixels = image.size.width * image.scale * image.size.height * image.scale
+        return Int(pixels) * 4
+    }
+}
+
+/// ImageIO-backed decoder. Loose bundle files are hashed by content (once per name; the pipeline
+/// keeps the result) and downsampled with `CGImageSourceCreateThumbnailAtIndex`; asset-catalog
+/// images fall back to `UIImage(named:)`.
+struct UIKitImageDecoder: ImageDecoding {
+
+    private static let extensions = ["png", "jpg", "jpeg", "heic"]
+
+    func contentHash(named name: String) -> UInt64? {
+        if let url = Self.bundleURL(named: name),
+           let data = try? Data(contentsOf: url, options: .alwaysMapped) {
+            return ContentHash.fnv1a64(data)
+        }
+        // Asset-catalog images have no readable file; key them by name + build instead.
+        guard UIImage(named: name) != nil else { return nil }
+        let build = Bundle.main.infoDictionary?["CFBundleVersion"] as? String ?? ""
+        return ContentHash.fnv1a64("\(name)#\(build)")
+    }
+
+    func decode(named name: String, maxPixelSize: Int?) -> DecodedBitmap? {
+        TelemetryRecorder.shared.measure("image_decode", source: name) {
+            decodeUntimed(named: name, maxPixelSize: maxPixelSize)
+        }
+    }
+
+    private func decodeUntimed(named name: String, maxPixelSize: Int?) -> DecodedBitmap? {
+        var image: CGImage?
+        if let url = Self.bundleURL(named: name),
+           let source = CGImageSourceCreateWithURL(url as CFURL, nil) {
+            if let maxPixelSize {
+                let options: [CFString: Any] = [
+                    kCGImageSourceCreateThumbnailFromImageAlways: true,
+                    kCGImageSourceCreateThumbnailWithTransform: true,
+                    kCGImageSourceThumbnailMaxPixelSize: maxPixelSize
+                ]
+                image = CGImageSourceCreateThumbnailAtIndex(source, 0, options as CFDictionary)
+            } else {
+                image = CGImageSourceCreateImageAtIndex(source, 0, nil)
+            }
+        } else {
+            image = UIImage(named: name)?.cgImage
+        }
+        guard let image else { return nil }
+        return Self.render(image, maxPixelSize: maxPixelSize)
     }
 
-    /// Asynchronously load a bundled image by name (or return cached). This is optimized for bundled
-    /// assets that may be expensive to decode repeatedly.
-    func loadImageAsync(named name: String) async -> UIImage? {
-        if let img = image(forKey: name) { return img }
+    func makeImage(from bitmap: DecodedBitmap) -> UIImage? {
+        guard let provider = CGDataProvider(data: bitmap.pixels as CFData),
+              let cg = CGImage(
+                width: bitmap.width,
+                height: bitmap.height,
+                bitsPerComponent: 8,
+                bitsPerPixel: 32,
+                bytesPerRow: bitmap.bytesPerRow,
+                space: CGColorSpaceCreateDeviceRGB(),
+                bitmapInfo: CGBitmapInfo(rawValue: CGImageAlphaInfo.premultipliedLast.rawValue),
+                provider: provider,
+                decode: nil,
+                shouldInterpolate: true,
+                intent: .defaultIntent
+              ) else { return nil }
+        return UIImage(cgImage: cg)
+    }
 
-        return await withCheckedContinuation { cont in
-            DispatchQueue.global(qos: .userInitiated).async {
-                let img = UIImage(named: name)
-                if let img { self.set(img, forKey: name) }
-                cont.resume(returning: img)
+    private static func bundleURL(named name: String) -> URL? {
+        for ext in extensions {
+            if let url = Bundle.main.url(forResource: name, withExtension: ext) {
+                return url
             }
         }
+        return nil
+    }
+
+    /// Draws into an RGBA8 buffer (scaling down if needed), which forces the decode to happen
+    /// here on the loader thread instead of lazily on first draw.
+    private static func render(_ image: CGImage, maxPixelSize: Int?) -> DecodedBitmap? {
+        var width = image.width
+        var height = image.height
+        if let maxPixelSize, max(width, height) > maxPixelSize {
+            let scale = Double(maxPixelSize) / Double(max(width, height))
+            width = max(Int(Double(width) * scale), 1)
+            height = max(Int(Double(height) * scale), 1)
+        }
+
+        let bytesPerRow = width * 4
+        var pixels = Data(count: bytesPerRow * height)
+        let drawn = pixels.withUnsafeMutableBytes { raw -> Bool in
+            guard let ctx = CGContext(
+                data: raw.baseAddress,
+                width: width,
+                height: height,
+                bitsPerComponent: 8,
+                bytesPerRow: bytesPerRow,
+                space: CGColorSpaceCreateDeviceRGB(),
+                bitmapInfo: CGImageAlphaInfo.premultipliedLast.rawValue
+            ) else { return false }
+            ctx.interpolationQuality = .high
+            ctx.draw(image, in: CGRect(x: 0, y: 0, width: width, height: height))
+            return true
+        }
+        return drawn ? DecodedBitmap(width: width, height: height, bytesPerRow: bytesPerRow, pixels: pixels) : nil
     }
 }
@@ -0,0 +1,138 @@
+import Foundation
+
+/// Platform half of the image pipeline: finding, hashing and decoding sources, and wrapping
+/// decoded bitmaps in the platform image type. Everything else lives in `ImagePipeline`.
+protocol ImageDecoding: Sendable {
+    associatedtype Image
+
+    /// Hash of the source content (or a stand-in when the bytes aren't readable). nil if missing.
+    func contentHash(named name: String) -> UInt64?
+
+    /// Decodes `name`, downsampled so the long edge is at most `maxPixelSize` when given.
+    func decode(named name: String, maxPixelSize: Int?) -> DecodedBitmap?
+
+    func makeImage(from bitmap: DecodedBitmap) -> Image?
+}
+
+/// Platform-independent image cache:
+/// memory LRU (cost = decoded bytes) → disk tier of pre-decoded thumbnails → decode.
+/// Concurrent requests for the same name+size share one load.
+/// Memory access is lock-protected and synchronous, so views can check it on the first frame.
+final class ImagePipeline<Decoder: ImageDecoding>: @unchecked Sendable {
+
+    let decoder: Decoder
+    let disk: ThumbnailDiskCache?
+    let counters = CacheCounters()
+
+    private let lock = NSLock()
+    private var memory: LRUCostCache<String, Decoder.Image>
+    private let inFlight = RequestCoalescer<String, UncheckedSendable<Decoder.Image?>>()
+    /// Source hash by name. Sources don't change while the app runs, so each is read once,
+    /// not on every memory miss.
+    private var hashes: [String: UInt64] = [:]
+
+    init(decoder: Decoder, costLimit: Int, countLimit: Int = .max, disk: ThumbnailDiskCache? = nil) {
+        self.decoder = decoder
+        self.disk = disk
+        self.memory = LRUCostCache(costLimit: costLimit, countLimit: countLimit)
+    }
+
+    static func memoryKey(name: String, maxPixelSize: Int?) -> String {
+        maxPixelSize.map { "\(name)@\($0)" } ?? name
+    }
+
+    // MARK: - Memory tier
+
+    /// Memory-only lookup; counts a hit when found.
+    func cachedImage(forKey key: String) -> Decoder.Image? {
+        lock.lock()
+        let image = memory.value(forKey: key)
+        lock.unlock()
+        if image != nil { counters.memoryHit() }
+        return image
+    }
+
+    func insert(_ image: Decoder.Image, cost: Int, forKey key: String) {
+        lock.lock()
+        let evicted = memory.insert(image, forKey: key, cost: cost)
+        lock.unlock()
+        counters.evicted(evicted.count)
+    }
+
+    func removeAllFromMemory() {
+        lock.lock()
+        memory.removeAll()
+        lock.unlock()
+    }
+
+    var memoryCost: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return memory.totalCost
+    }
+
+    var memoryCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return memory.count
+    }
+
+    // MARK: - Loading
+
+    /// Memory hit, or one shared disk read / decode per name+size however many callers ask.
+    func image(named name: String, maxPixelSize: Int? = nil, priority: TaskPriority? = nil) async -> Decoder.Image? {
+        let key = Self.memoryKey(name: name, maxPixelSize: maxPixelSize)
+        if let hit = cachedImage(forKey: key) { return hit }
+
+        let result = try? await inFlight.run(key, priority: priority) { [self] in
+            UncheckedSendable(value: load(name: name, maxPixelSize: maxPixelSize, key: key))
+        }
+        if result?.joined == true { counters.coalesced() }
+        return result?.value.value
+    }
+
+    private func load(name: String, maxPixelSize: Int?, key: String) -> Decoder.Image? {
+        let start = DispatchTime.now().uptimeNanoseconds
+
+        // Only downsampled thumbnails go to disk; full-size bitmaps would dwarf their sources.
+        let thumbKey = (disk != nil && maxPixelSize != nil)
+            ? contentHash(named: name).map { ThumbnailKey(contentHash: $0, maxPixelSize: maxPixelSize ?? 0) }
+            : nil
+
+        var bitmap: DecodedBitmap?
+        var fromDisk = false
+        if let thumbKey, let stored = disk?.bitmap(for: thumbKey) {
+            bitmap = stored
+            fromDisk = true
+        } else if let decoded = decoder.decode(named: name, maxPixelSize: maxPixelSize) {
+            bitmap = decoded
+            if let thumbKey { disk?.store(decoded, for: thumbKey) }
+        }
+
+        let image = bitmap.flatMap { decoder.makeImage(from: $0) }
+        if let image, let bitmap {
+            insert(image, cost: bitmap.byteCount, forKey: key)
+        }
+
+        let nanos = DispatchTime.now().uptimeNanoseconds - start
+        if fromDisk {
+            counters.diskHit(nanos: nanos)
+        } else {
+            counters.miss(nanos: nanos)
+        }
+        return image
+    }
+
+    private func contentHash(named name: String) -> UInt64? {
+        lock.lock()
+        let known = hashes[name]
+        lock.unlock()
+        if let known { return known }
+
+        guard let hash = decoder.contentHash(named: name) else { return nil }
+        lock.lock()
+        hashes[name] = hash
+        lock.unlock()
+        return hash
+    }
+}
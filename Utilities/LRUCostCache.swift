@@ -0,0 +1,168 @@
+import Foundation
+
+/// O(1) least-recently-used store bounded by total cost and entry count.
+///
+/// A hash map points into slot arrays that double as an intrusive doubly-linked list
+/// (`prev`/`next` are slot indices, most recent at `head`), so lookup, promotion,
+/// insertion and eviction never scan. Freed slots are reused.
+/// Value type, not synchronized: wrap it in a lock or an actor to share it.
+struct LRUCostCache<Key: Hashable, Value> {
+
+    private(set) var costLimit: Int
+    private(set) var countLimit: Int
+    private(set) var totalCost = 0
+
+    private var index: [Key: Int] = [:]
+    private var keys: [Key?] = []
+    private var values: [Value?] = []
+    private var costs: [Int] = []
+    private var prev: [Int] = []
+    private var next: [Int] = []
+    private var free: [Int] = []
+    private var head = -1
+    private var tail = -1
+
+    var count: Int { index.count }
+    var isEmpty: Bool { index.isEmpty }
+
+    init(costLimit: Int = .max, countLimit: Int = .max) {
+        self.costLimit = costLimit
+        self.countLimit = countLimit
+    }
+
+    // MARK: - Access
+
+    /// Returns the value and marks it most recently used.
+    mutating func value(forKey key: Key) -> Value? {
+        guard let i = index[key] else { return nil }
+        promote(i)
+        return values[i]
+    }
+
+    /// Returns the value without touching recency.
+    func peek(_ key: Key) -> Value? {
+        index[key].flatMap { values[$0] }
+    }
+
+    func contains(_ key: Key) -> Bool {
+        index[key] != nil
+    }
+
+    func cost(forKey key: Key) -> Int? {
+        index[key].map { costs[$0] }
+    }
+
+    /// Keys from most to least recently used.
+    var keysByRecency: [Key] {
+        var out: [Key] = []
+        out.reserveCapacity(count)
+        var i = head
+        while i >= 0 {
+            if let k = keys[i] { out.append(k) }
+            i = next[i]
+        }
+        return out
+    }
+
+    // MARK: - Mutation
+
+    /// Inserts or replaces `value`, marks it most recent, then evicts from the cold end until
+    /// both limits hold. An entry bigger than `costLimit` on its own is evicted immediately.
+    /// Returns what was evicted so callers can release or count it.
+    @discardableResult
+    mutating func insert(_ value: Value, forKey key: Key, cost: Int = 1) -> [(key: Key, value: Value)] {
+        let cost = max(cost, 0)
+        if let i = index[key] {
+            totalCost += cost - costs[i]
+            values[i] = value
+            costs[i] = cost
+            promote(i)
+        } else {
+            let i: Int
+            if let reused = free.popLast() {
+                i = reused
+                keys[i] = key
+                values[i] = value
+                costs[i] = cost
+            } else {
+                i = keys.count
+                keys.append(key)
+                values.append(value)
+                costs.append(cost)
+                prev.append(-1)
+                next.append(-1)
+            }
+            index[key] = i
+            totalCost += cost
+            pushFront(i)
+        }
+        return evictToLimits()
+    }
+
+    @discardableResult
+    mutating func removeValue(forKey key: Key) -> Value? {
+        guard let i = index[key] else { return nil }
+        return release(i)
+    }
+
+    mutating func removeAll() {
+        self = LRUCostCache(costLimit: costLimit, countLimit: countLimit)
+    }
+
+    /// Changes the limits, evicting immediately if the new ones are tighter.
+    @discardableResult
+    mutating func setLimits(cost: Int? = nil, count: Int? = nil) -> [(key: Key, value: Value)] {
+        if let cost { costLimit = cost }
+        if let count { countLimit = count }
+        return evictToLimits()
+    }
+
+    // MARK: - List plumbing
+
+    private mutating func evictToLimits() -> [(key: Key, value: Value)] {
+        var evicted: [(key: Key, value: Value)] = []
+        while (totalCost > costLimit || index.count > countLimit) && tail >= 0 {
+            let i = tail
+            let k = keys[i]
+            if let v = release(i), let k {
+                evicted.append((k, v))
+            }
+        }
+        return evicted
+    }
+
+    private mutating func release(_ i: Int) -> Value? {
+        unlink(i)
+        let value = values[i]
+        if let k = keys[i] { index[k] = nil }
+        totalCost -= costs[i]
+        keys[i] = nil
+        values[i] = nil
+        costs[i] = 0
+        free.append(i)
+        return value
+    }
+
+    private mutating func promote(_ i: Int) {
+        guard head != i else { return }
+        unlink(i)
+        pushFront(i)
+    }
+
+    private mutating func unlink(_ i: Int) {
+        let p = prev[i]
+        let n = next[i]
+        if p >= 0 { next[p] = n } else { head = n }
+        if n >= 0 { prev[n] = p } else { tail = p }
+        prev[i] = -1
+        next[i] = -1
+    }
+
+    private mutating func pushFront(_ i: Int) {
+        prev[i] = -1
+        next[i] = head
+        if head >= 0 { prev[head] = i }
+        head = i
+        if tail < 0 { tail = i }
+    }
+}
@@ -1,59 +1,132 @@
 import Foundation
 import SceneKit
+import ImageIO
+#if canImport(UIKit)
+import UIKit
+#endif
 
-/// Simple in-memory cache for SCNScene objects loaded from bundled USDZ/scene files.
-/// Uses NSCache to allow automatic eviction under memory pressure.
-final class SceneCache {
+/// In-memory cache for SCNScene objects loaded from bundled USDZ/scene files.
+/// Scenes are charged their real geometry + texture bytes against a 200MB budget; loads run
+/// off-main and are shared between concurrent callers. Policy lives in `AsyncLRUCache`.
+final class SceneCache: Sendable {
     static let shared = SceneCache()
 
-    private let cache = NSCache<NSString, SCNScene>()
+    let cache: AsyncLRUCache<String, SCNScene>
+
     private init() {
-        // Sensible defaults; tune if you have many heavy scenes.
-        cache.countLimit = 16
-        cache.totalCostLimit = 200 * 1024 * 1024 // ~200MB
+        cache = AsyncLRUCache(
+            costLimit: 200 * 1024 * 1024, // ~200MB
+            countLimit: 16,
+            cost: { SceneCost.bytes(of: $0) },
+            load: { name in
+                await TelemetryRecorder.shared.measure("scene_load", source: name) {
+                    SceneCache.loadFromBundle(named: name)
+                }
+            }
+        )
+
+        #if canImport(UIKit)
+        // NSCache used to drop itself under pressure; keep that behavior.
+        NotificationCenter.default.addObserver(
+            forName: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil,
+            queue: nil
+        ) { [cache] _ in
+            Task { await cache.removeAll() }
+        }
+        #endif
     }
 
     /// Load a scene for a bundle resource name (without extension), caching the result.
-    /// This runs on a background thread and returns the loaded SCNScene or nil if not found.
+    /// Returns nil if no usdz/scn/dae by that name loads.
     func loadScene(named name: String) async -> SCNScene? {
-        if let cached = cache.object(forKey: name as NSString) {
-            return cached
+        await cache.value(for: name)
+    }
+
+    /// Warms scenes in the background, most likely first; cached or loading names are skipped.
+    func prefetch(_ names: [String]) {
+        guard !names.isEmpty else { return }
+        Task { await cache.prefetch(names) }
+    }
+
+    func removeScene(named name: String) {
+        Task { await cache.removeValue(for: name) }
+    }
+
+    var stats: CacheStats { cache.counters.snapshot }
+
+    private static func loadFromBundle(named name: String) -> SCNScene? {
+        // USDZ is common but allow .scn/.dae if present.
+        for ext in ["usdz", "scn", "dae"] {
+            guard let url = Bundle.main.url(forResource: name, withExtension: ext) else { continue }
+            if let scene = try? SCNScene(url: url, options: nil) {
+                return scene
+            }
+            if let scene = SCNScene(named: "\(name).\(ext)") {
+                return scene
+            }
         }
+        return nil
+    }
+}
 
-        return await withCheckedContinuation { continuation in
-            DispatchQueue.global(qos: .userInitiated).async {
-                // Try possible extensions in order; USDZ is common but allow .scn/.dae if present.
-                let exts = ["usdz", "scn", "dae"]
-                var loaded: SCNScene? = nil
-
-                for ext in exts {
-                    if let url = Bundle.main.url(forResource: name, withExtension: ext) {
-                        // Try SCNScene initializer that accepts URL (may throw), wrap in try?
-                        if let scene = try? SCNScene(url: url, options: nil) {
-                            loaded = scene
-                            break
-                        }
-                        // Fallback to named initializer (uses bundle lookup)
-                        if let scene = SCNScene(named: "\(name).\(ext)") {
-                            loaded = scene
-                            break
-                        }
-                    }
-                }
+/// Approximate resident size of a scene: geometry source/element buffers plus decoded texture
+/// bytes (width × height × 4). Shared geometries and images are only counted once.
+enum SceneCost {
 
-                if let scene = loaded {
-                    // Cache with a rough cost estimate: sum geometry vertex buffers sizes isn't trivial here,
-                    // so we use an approximate fixed cost per scene; NSCache will evict on pressure.
-                    self.cache.setObject(scene, forKey: name as NSString, cost: 1)
-                }
+    private static let textureSlots: [KeyPath<SCNMaterial, SCNMaterialProperty>] = [
+        \.diffuse, \.normal, \.specular, \.emission, \.metalness, \.roughness, \.ambientOcclusion, \.transparent
+    ]
+
+    static func bytes(of scene: SCNScene) -> Int {
+        var geometries = Set<ObjectIdentifier>()
+        var textures = Set<String>()
+        var total = 0
 
-                continuation.resume(returning: loaded)
+        scene.rootNode.enumerateHierarchy { node, _ in
+            guard let geometry = node.geometry,
+                  geometries.insert(ObjectIdentifier(geometry)).inserted else { return }
+            for source in geometry.sources {
+                total += source.data.count
+            }
+            for element in geometry.elements {
+                total += element.data.count
+            }
+            for material in geometry.materials {
+                for slot in textureSlots {
+                    total += textureBytes(material[keyPath: slot].contents, seen: &textures)
+                }
             }
         }
+        return max(total, 1)
     }
 
-    /// Remove a cached scene (optional).
-    func removeScene(named name: String) {
-        cache.removeObject(forKey: name as NSString)
+    private static func textureBytes(_ contents: Any?, seen: inout Set<String>) -> Int {
+        guard let contents else { return 0 }
+        #if canImport(UIKit)
+        if let image = contents as? UIImage, let cg = image.cgImage {
+            return seen.insert("\(ObjectIdentifier(image))").inserted ? cg.bytesPerRow * cg.height : 0
+        }
+        #endif
+        if CFGetTypeID(contents as CFTypeRef) == CGImage.typeID {
+            let cg = contents as! CGImage
+            return seen.insert("\(ObjectIdentifier(cg))").inserted ? cg.bytesPerRow * cg.height : 0
+        }
+
+        let url: URL?
+        if let u = contents as? URL {
+            url = u
+        } else if let path = contents as? String {
+            url = URL(fileURLWithPath: path)
+        } else {
+            url = nil
+        }
+        // Colors and other non-image contents cost nothing extra.
+        guard let url, seen.insert(url.absoluteString).inserted,
+              let source = CGImageSourceCreateWithURL(url as CFURL, nil),
+              let props = CGImageSourceCopyPropertiesAtIndex(source, 0, nil) as? [CFString: Any],
+              let width = props[kCGImagePropertyPixelWidth] as? Int,
+              let height = props[kCGImagePropertyPixelHeight] as? Int else { return 0 }
+        return width * height * 4
     }
 }
@@ -0,0 +1,319 @@
+import Foundation
+
+/// Something that can turn a product's name and description into a short summary:
+/// today the heuristic below, later an on-device model.
+protocol SummaryBackend: Sendable {
+    /// Part of every cache key, so switching backends (or prompt versions) never serves old text.
+    var identity: String { get }
+
+    func summarize(name: String, description: String) async throws -> String
+}
+
+/// The original AIService summary: first sentence of the description plus a fixed feature list.
+struct HeuristicSummaryBackend: SummaryBackend {
+    let identity = "heuristic-v1"
+
+    func summarize(name: String, description: String) async throws -> String {
+        Self.summary(name: name, description: description)
+    }
+
+    static func summary(name: String, description: String) -> String {
+        let firstSentence = description.split(maxSplits: 1, omittingEmptySubsequences: true, whereSeparator: { $0 == "." || $0 == "!" || $0 == "?" }).first?.trimmingCharacters(in: .whitespacesAndNewlines) ?? description
+
+        let features = [
+            "Compact, modern design",
+            "Optimized for Foundation ecosystems",
+            "Supports AR & 3D preview"
+        ]
+
+        return "\(firstSentence).\n\nKey features:\n- \(features.joined(separator: "\n- "))"
+    }
+}
+
+struct SummaryRequest: Hashable, Sendable {
+    let name: String
+    let description: String
+}
+
+/// How one batch went. Latencies cover generated items only; cached ones cost a lookup.
+struct SummaryBatchReport: Sendable {
+    var requested = 0
+    var cached = 0
+    var generated = 0
+    /// Duplicates within the batch, or items another caller was already generating.
+    var joined = 0
+    var failed = 0
+    var totalMs = 0.0
+    /// Ascending.
+    var latenciesMs: [Double] = []
+
+    var generatedPerSecond: Double {
+        totalMs == 0 ? 0 : Double(generated) / totalMs * 1_000
+    }
+
+    func percentileMs(_ p: Double) -> Double {
+        guard !latenciesMs.isEmpty else { return 0 }
+        let rank = Int((p * Double(latenciesMs.count - 1)).rounded())
+        return latenciesMs[min(max(rank, 0), latenciesMs.count - 1)]
+    }
+}
+
+// MARK: - Store
+
+/// Summaries by key, in memory with a JSON file behind it so they survive relaunch.
+/// Lookups are lock-protected and synchronous. Writing rewrites the whole file, so one-off
+/// additions go through `scheduleFlush()`, which batches everything stored within
+/// `flushDelay` into one background write; `flush()` writes now and blocks on I/O.
+final class SummaryStore: @unchecked Sendable {
+
+    private struct File: Codable {
+        var version: Int
+        /// Hex key → summary.
+        var entries: [String: String]
+    }
+
+    private static let version = 1
+
+    let fileURL: URL?
+    let flushDelay: TimeInterval
+
+    private let lock = NSLock()
+    private let writeLock = NSLock()
+    private var entries: [UInt64: String]
+    private var dirty = false
+    private var flushScheduled = false
+    private let queue = DispatchQueue(label: "aquire.summary-store", qos: .utility)
+
+    /// nil keeps everything in memory (benchmarks, previews).
+    init(fileURL: URL?, flushDelay: TimeInterval = 1.0) {
+        self.fileURL = fileURL
+        self.flushDelay = flushDelay
+        self.entries = fileURL.flatMap(Self.read) ?? [:]
+    }
+
+    var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return entries.count
+    }
+
+    func summary(for key: UInt64) -> String? {
+        lock.lock()
+        defer { lock.unlock() }
+        return entries[key]
+    }
+
+    func store(_ summary: String, for key: UInt64) {
+        lock.lock()
+        entries[key] = summary
+        dirty = true
+        lock.unlock()
+    }
+
+    /// Drops summaries for anything not in `keys`, e.g. products whose description changed.
+    func retain(only keys: Set<UInt64>) {
+        lock.lock()
+        let before = entries.count
+        entries = entries.filter { keys.contains($0.key) }
+        dirty = dirty || entries.count != before
+        lock.unlock()
+    }
+
+    func removeAll() {
+        lock.lock()
+        entries.removeAll()
+        dirty = true
+        lock.unlock()
+    }
+
+    /// Flushes on a background queue `flushDelay` from now, unless a flush is already pending.
+    func scheduleFlush() {
+        guard fileURL != nil else { return }
+        lock.lock()
+        let schedule = !flushScheduled
+        flushScheduled = true
+        lock.unlock()
+
+        guard schedule else { return }
+        queue.asyncAfter(deadline: .now() + flushDelay) { [self] in
+            lock.lock()
+            flushScheduled = false
+            lock.unlock()
+            flush()
+        }
+    }
+
+    /// Writes the file if anything changed since the last flush.
+    func flush() {
+        guard let fileURL else { return }
+        writeLock.lock()
+        defer { writeLock.unlock() }
+
+        lock.lock()
+        guard dirty else {
+            lock.unlock()
+            return
+        }
+        let snapshot = entries
+        dirty = false
+        lock.unlock()
+
+        var file = File(version: Self.version, entries: [:])
+        file.entries.reserveCapacity(snapshot.count)
+        for (key, summary) in snapshot {
+            file.entries[String(key, radix: 16)] = summary
+        }
+        guard let data = try? JSONEncoder().encode(file) else { return }
+        try? FileManager.default.createDirectory(at: fileURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+        try? data.write(to: fileURL, options: .atomic)
+    }
+
+    private static func read(_ url: URL) -> [UInt64: String]? {
+        guard let data = try? Data(contentsOf: url),
+              let file = try? JSONDecoder().decode(File.self, from: data),
+              file.version == version else { return nil }
+        var out: [UInt64: String] = [:]
+        out.reserveCapacity(file.entries.count)
+        for (hex, summary) in file.entries {
+            if let key = UInt64(hex, radix: 16) { out[key] = summary }
+        }
+        return out
+    }
+}
+
+// MARK: - Engine
+
+/// Memoized summaries over a pluggable backend.
+///
+/// Each summary is generated at most once per name + description + backend: results are kept in
+/// a persistent `SummaryStore`, and concurrent requests for the same product share one backend
+/// call. `summarizeAll` precomputes a whole catalog with at most `maxConcurrent` calls in flight,
+/// so views can stick to `cachedSummary`, which never generates.
+/// Foundation-only; the app facade is AIService, the harness is tools/bench/summaries.
+final class SummaryEngine: Sendable {
+
+    enum Outcome: Sendable {
+        case cached
+        case generated
+        case joined
+        case failed
+    }
+
+    let backend: any SummaryBackend
+    let store: SummaryStore
+    let maxConcurrent: Int
+    let counters = CacheCounters()
+
+    private let inFlight = RequestCoalescer<UInt64, String>()
+
+    init(backend: any SummaryBackend, store: SummaryStore = SummaryStore(fileURL: nil), maxConcurrent: Int = 4) {
+        self.backend = backend
+        self.store = store
+        self.maxConcurrent = max(maxConcurrent, 1)
+    }
+
+    func key(for request: SummaryRequest) -> UInt64 {
+        // Unit separators keep ("ab", "c") and ("a", "bc") apart.
+        ContentHash.fnv1a64("\(backend.identity)\u{1F}\(request.name)\u{1F}\(request.description)")
+    }
+
+    /// Stored summary or nil; never calls the backend.
+    func cachedSummary(for request: SummaryRequest) -> String? {
+        let summary = store.summary(for: key(for: request))
+        if summary != nil { counters.memoryHit() }
+        return summary
+    }
+
+    /// Stored summary, or one generated now (shared with anyone already generating it). New
+    /// summaries reach disk with the store's next debounced flush.
+    func summary(for request: SummaryRequest, priority: TaskPriority? = .userInitiated) async -> String? {
+        let key = self.key(for: request)
+        let (summary, outcome) = await resolve(request, key: key, priority: priority)
+        if outcome == .generated { store.scheduleFlush() }
+        return summary
+    }
+
+    /// Summarizes everything not already stored, `maxConcurrent` at a time (default: the
+    /// engine's limit), and saves once at the end.
+    func summarizeAll(_ requests: [SummaryRequest], maxConcurrent: Int? = nil, priority: TaskPriority = .utility) async -> SummaryBatchReport {
+        let limit = max(maxConcurrent ?? self.maxConcurrent, 1)
+        let start = DispatchTime.now().uptimeNanoseconds
+        var report = SummaryBatchReport(requested: requests.count)
+
+        // Cached items never take a slot; duplicates in the batch ride along with the first.
+        var pending: [(request: SummaryRequest, key: UInt64)] = []
+        var seen = Set<UInt64>()
+        for request in requests {
+            let key = self.key(for: request)
+            if store.summary(for: key) != nil {
+                report.cached += 1
+            } else if seen.insert(key).inserted {
+                pending.append((request, key))
+            } else {
+                report.joined += 1
+            }
+        }
+
+        await withTaskGroup(of: (outcome: Outcome, ms: Double).self) { group in
+            var next = 0
+            var running = 0
+            while next < pending.count || running > 0 {
+                while next < pending.count && running < limit {
+                    let item = pending[next]
+                    next += 1
+                    running += 1
+                    group.addTask(priority: priority) {
+                        let begin = DispatchTime.now().uptimeNanoseconds
+                        let (_, outcome) = await self.resolve(item.request, key: item.key, priority: priority)
+                        return (outcome, Double(DispatchTime.now().uptimeNanoseconds - begin) / 1_000_000)
+                    }
+                }
+                guard let result = await group.next() else { break }
+                running -= 1
+                switch result.outcome {
+                case .generated:
+                    report.generated += 1
+                    report.latenciesMs.append(result.ms)
+                case .cached:
+                    report.cached += 1
+                case .joined:
+                    report.joined += 1
+                case .failed:
+                    report.failed += 1
+                }
+            }
+        }
+
+        report.latenciesMs.sort()
+        report.totalMs = Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000
+        store.flush()
+        return report
+    }
+
+    private func resolve(_ request: SummaryRequest, key: UInt64, priority: TaskPriority?) async -> (String?, Outcome) {
+        if let stored = store.summary(for: key) {
+            counters.memoryHit()
+            return (stored, .cached)
+        }
+        let backend = self.backend
+        let store = self.store
+        let start = DispatchTime.now().uptimeNanoseconds
+        do {
+            // Stored inside the shared load, before it completes, so a caller arriving just after
+            // it leaves the coalescer finds it in the store instead of generating again.
+            let (summary, joined) = try await inFlight.run(key, priority: priority) {
+                let summary = try await backend.summarize(name: request.name, description: request.description)
+                store.store(summary, for: key)
+                return summary
+            }
+            if joined {
+                counters.coalesced()
+                return (summary, .joined)
+            }
+            counters.miss(nanos: DispatchTime.now().uptimeNanoseconds - start)
+            return (summary, .generated)
+        } catch {
+            return (nil, .failed)
+        }
+    }
+}
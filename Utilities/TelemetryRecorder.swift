@@ -0,0 +1,388 @@
+import Foundation
+
+/// A decoded ring entry.
+struct TelemetryRecord: Hashable, Codable, Sendable {
+
+    enum Kind: String, Codable, Sendable {
+        case event
+        case begin
+        case end
+
+        var code: UInt8 {
+            switch self {
+            case .event: return 0
+            case .begin: return 1
+            case .end: return 2
+            }
+        }
+
+        init?(code: UInt8) {
+            switch code {
+            case 0: self = .event
+            case 1: self = .begin
+            case 2: self = .end
+            default: return nil
+            }
+        }
+    }
+
+    /// Ring ticket; increases monotonically per recorder.
+    let sequence: Int
+    let kind: Kind
+    let name: String
+    let source: String
+    /// Uptime, nanoseconds.
+    let timestamp: UInt64
+    /// Span length in nanoseconds; `end` records only.
+    let duration: UInt64
+    /// Sequence of the span's `begin` record, for `begin`/`end` records.
+    let span: Int?
+}
+
+/// Returned by `TelemetryRecorder.begin`; pass it to `end` (from any thread).
+struct TelemetrySpan: Sendable {
+    let name: String
+    let source: String
+    let id: Int
+    let start: UInt64
+}
+
+/// Log2-bucketed latency distribution: bucket `i` counts durations in [2^(i-1), 2^i) ns.
+/// Percentiles are the bucket's upper bound, so they're within 2x and never under-report.
+struct LatencyHistogram: Equatable, Sendable {
+
+    private(set) var buckets = [UInt64](repeating: 0, count: 65)
+    private(set) var count = 0
+    private(set) var totalNanos: UInt64 = 0
+    private(set) var minNanos: UInt64 = .max
+    private(set) var maxNanos: UInt64 = 0
+
+    mutating func record(_ nanos: UInt64) {
+        buckets[64 - nanos.leadingZeroBitCount] += 1
+        count += 1
+        totalNanos &+= nanos
+        minNanos = min(minNanos, nanos)
+        maxNanos = max(maxNanos, nanos)
+    }
+
+    var meanMs: Double {
+        count == 0 ? 0 : Double(totalNanos) / Double(count) / 1_000_000
+    }
+
+    /// `p` in 0...1.
+    func percentileMs(_ p: Double) -> Double {
+        guard count > 0 else { return 0 }
+        let rank = UInt64((Double(count) * min(max(p, 0), 1)).rounded(.up))
+        var seen: UInt64 = 0
+        for (i, n) in buckets.enumerated() {
+            seen += n
+            if seen >= max(rank, 1) {
+                let upper = i == 0 ? 0 : (i >= 64 ? UInt64.max : (UInt64(1) << UInt64(i)) - 1)
+                return Double(min(upper, maxNanos)) / 1_000_000
+            }
+        }
+        return Double(maxNanos) / 1_000_000
+    }
+}
+
+/// What the UI samples: the latest records and the per-name span histograms.
+struct TelemetrySnapshot: Sendable {
+    /// Newest first.
+    var recent: [TelemetryRecord] = []
+    var histograms: [String: LatencyHistogram] = [:]
+    /// Records written since the last clear.
+    var recorded = 0
+    /// Records overwritten before they were sampled (not in `recent` or `histograms`).
+    var dropped = 0
+}
+
+enum TelemetryExportFormat {
+    /// One JSON object per line.
+    case jsonLines
+    /// "AQT1" | u32 count | records (see `TelemetryCodec`).
+    case binary
+}
+
+/// High-throughput instrumentation surface.
+///
+/// `log`, `begin` and `end` write a fixed-size slot into a `TelemetryRing` and return: no
+/// allocation, callable from any thread, and lock-free from iOS 18 (on iOS 17 the ring's
+/// sequencer takes brief locks). Everything else (histograms, the recent list, exports) is built
+/// on the reading side when someone asks for a snapshot, so writers never pay for it. If writers
+/// get more than `capacity` records ahead of the last snapshot, the oldest are overwritten and
+/// counted as dropped.
+/// Foundation-only so it can be benchmarked on Linux (see tools/bench/telemetry).
+final class TelemetryRecorder: @unchecked Sendable {
+    static let shared = TelemetryRecorder()
+
+    let ring: TelemetryRing
+    let recentLimit: Int
+
+    // Reader state, guarded by `readLock`. Writers never take it.
+    private let readLock = NSLock()
+    private var readTicket = 0
+    private var clearedAt = 0
+    private var recent: [TelemetryRecord] = []
+    private var histograms: [String: LatencyHistogram] = [:]
+    private var dropped = 0
+
+    init(capacity: Int = 16_384, recentLimit: Int = 200) {
+        self.ring = TelemetryRing(capacity: capacity)
+        self.recentLimit = recentLimit
+    }
+
+    static func now() -> UInt64 {
+        DispatchTime.now().uptimeNanoseconds
+    }
+
+    // MARK: - Writing
+
+    func log(_ name: String, source: String = "app") {
+        ring.append(TelemetrySlot(
+            kind: TelemetryRecord.Kind.event.code,
+            timestamp: Self.now(),
+            name: TelemetryText(name),
+            source: TelemetryText(source)
+        ))
+    }
+
+    func begin(_ name: String, source: String = "app") -> TelemetrySpan {
+        let start = Self.now()
+        let id = ring.append(TelemetrySlot(
+            kind: TelemetryRecord.Kind.begin.code,
+            timestamp: start,
+            name: TelemetryText(name),
+            source: TelemetryText(source)
+        ))
+        return TelemetrySpan(name: name, source: source, id: id, start: start)
+    }
+
+    func end(_ span: TelemetrySpan) {
+        let now = Self.now()
+        ring.append(TelemetrySlot(
+            kind: TelemetryRecord.Kind.end.code,
+            timestamp: now,
+            duration: now - span.start,
+            span: UInt64(span.id) + 1,
+            name: TelemetryText(span.name),
+            source: TelemetryText(span.source)
+        ))
+    }
+
+    func measure<T>(_ name: String, source: String = "app", _ body: () throws -> T) rethrows -> T {
+        let span = begin(name, source: source)
+        defer { end(span) }
+        return try body()
+    }
+
+    func measure<T>(_ name: String, source: String = "app", _ body: () async throws -> T) async rethrows -> T {
+        let span = begin(name, source: source)
+        defer { end(span) }
+        return try await body()
+    }
+
+    // MARK: - Reading
+
+    /// Folds everything written since the last call into the histograms and recent list.
+    func snapshot() -> TelemetrySnapshot {
+        readLock.lock()
+        defer { readLock.unlock() }
+        drain()
+        return TelemetrySnapshot(
+            recent: recent.reversed(),
+            histograms: histograms,
+            recorded: ring.head - clearedAt,
+            dropped: dropped
+        )
+    }
+
+    /// Every record still in the ring since the last clear, oldest first.
+    /// Doesn't affect what `snapshot` has consumed.
+    func records() -> [TelemetryRecord] {
+        readLock.lock()
+        let floor = clearedAt
+        readLock.unlock()
+
+        let head = ring.head
+        var out: [TelemetryRecord] = []
+        out.reserveCapacity(min(head - floor, ring.capacity))
+        for ticket in max(floor, head - ring.capacity)..<head {
+            if case .ready(let slot) = ring.read(ticket) {
+                out.append(Self.record(slot, ticket: ticket))
+            }
+        }
+        return out
+    }
+
+    func export(_ format: TelemetryExportFormat) -> Data {
+        switch format {
+        case .jsonLines: return TelemetryCodec.jsonLines(records())
+        case .binary: return TelemetryCodec.encode(records())
+        }
+    }
+
+    /// Forgets history. Writers in flight are unaffected; their records land after the cut.
+    func clear() {
+        readLock.lock()
+        defer { readLock.unlock() }
+        let head = ring.head
+        readTicket = head
+        clearedAt = head
+        recent.removeAll()
+        histograms.removeAll()
+        dropped = 0
+    }
+
+    /// Caller holds `readLock`.
+    private func drain() {
+        let head = ring.head
+        var ticket = readTicket
+        let oldest = head - ring.capacity
+        if ticket < oldest {
+            dropped += oldest - ticket
+            ticket = oldest
+        }
+        scan: while ticket < head {
+            switch ring.read(ticket) {
+            case .ready(let slot):
+                ingest(Self.record(slot, ticket: ticket))
+            case .overwritten:
+                dropped += 1
+            case .pending:
+                // A writer is mid-copy; pick up from here next time.
+                break scan
+            }
+            ticket += 1
+        }
+        readTicket = ticket
+
+        // Trim in batches so the recent list stays amortized O(1) per record.
+        if recent.count > recentLimit * 2 {
+            recent.removeFirst(recent.count - recentLimit)
+        }
+    }
+
+    private func ingest(_ record: TelemetryRecord) {
+        recent.append(record)
+        if record.kind == .end {
+            histograms[record.name, default: LatencyHistogram()].record(record.duration)
+        }
+    }
+
+    private static func record(_ slot: TelemetrySlot, ticket: Int) -> TelemetryRecord {
+        TelemetryRecord(
+            sequence: ticket,
+            kind: TelemetryRecord.Kind(code: slot.kind) ?? .event,
+            name: slot.name.string,
+            source: slot.source.string,
+            timestamp: slot.timestamp,
+            duration: slot.duration,
+            span: slot.kind == TelemetryRecord.Kind.event.code
+                ? nil
+                : (slot.kind == TelemetryRecord.Kind.begin.code ? ticket : Int(slot.span) - 1)
+        )
+    }
+}
+
+// MARK: - Export formats
+
+/// Binary layout (little-endian): "AQT1" | u32 count | per record:
+/// u64 sequence | u8 kind | u64 timestamp | u64 duration | u64 span+1 (0 = none) |
+/// u8 name length | name | u8 source length | source.
+enum TelemetryCodec {
+
+    private static let magic: [UInt8] = Array("AQT1".utf8)
+
+    static func jsonLines(_ records: [TelemetryRecord]) -> Data {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.sortedKeys]
+        var out = Data()
+        for record in records {
+            guard let line = try? encoder.encode(record) else { continue }
+            out.append(line)
+            out.append(0x0A)
+        }
+        return out
+    }
+
+    static func encode(_ records: [TelemetryRecord]) -> Data {
+        var out = Data(capacity: 8 + records.count * 48)
+        out.append(contentsOf: magic)
+        append(UInt32(records.count), to: &out)
+        for r in records {
+            append(UInt64(r.sequence), to: &out)
+            out.append(r.kind.code)
+            append(r.timestamp, to: &out)
+            append(r.duration, to: &out)
+            append(r.span.map { UInt64($0) + 1 } ?? 0, to: &out)
+            appendText(r.name, to: &out)
+            appendText(r.source, to: &out)
+        }
+        return out
+    }
+
+    /// nil if the data is truncated or not in this format.
+    static func decode(_ data: Data) -> [TelemetryRecord]? {
+        var reader = Reader(bytes: [UInt8](data))
+        guard reader.take(4) == magic, let count = reader.u32() else { return nil }
+        var out: [TelemetryRecord] = []
+        out.reserveCapacity(Int(count))
+        for _ in 0..<count {
+            guard let sequence = reader.u64(),
+                  let code = reader.u8(), let kind = TelemetryRecord.Kind(code: code),
+                  let timestamp = reader.u64(),
+                  let duration = reader.u64(),
+                  let span = reader.u64(),
+                  let name = reader.text(),
+                  let source = reader.text() else { return nil }
+            out.append(TelemetryRecord(
+                sequence: Int(sequence),
+                kind: kind,
+                name: name,
+                source: source,
+                timestamp: timestamp,
+                duration: duration,
+                span: span == 0 ? nil : Int(span - 1)
+            ))
+        }
+        return out
+    }
+
+    private static func append<T: FixedWidthInteger>(_ value: T, to out: inout Data) {
+        withUnsafeBytes(of: value.littleEndian) { out.append(contentsOf: $0) }
+    }
+
+    private static func appendText(_ string: String, to out: inout Data) {
+        let bytes = Array(string.utf8.prefix(255))
+        out.append(UInt8(bytes.count))
+        out.append(contentsOf: bytes)
+    }
+
+    private struct Reader {
+        let bytes: [UInt8]
+        var offset = 0
+
+        mutating func take(_ n: Int) -> [UInt8]? {
+            guard n >= 0, offset + n <= bytes.count else { return nil }
+            defer { offset += n }
+            return Array(bytes[offset..<offset + n])
+        }
+
+        mutating func u8() -> UInt8? {
+            take(1)?.first
+        }
+
+        mutating func u32() -> UInt32? {
+            take(4).map { $0.reversed().reduce(0) { $0 << 8 | UInt32($1) } }
+        }
+
+        mutating func u64() -> UInt64? {
+            take(8).map { $0.reversed().reduce(0) { $0 << 8 | UInt64($1) } }
+        }
+
+        mutating func text() -> String? {
+            guard let n = u8(), let raw = take(Int(n)) else { return nil }
+            return String(decoding: raw, as: UTF8.self)
+        }
+    }
+}
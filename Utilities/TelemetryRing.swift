@@ -0,0 +1,274 @@
+import Foundation
+import Synchronization
+
+/// Up to 32 bytes of UTF-8 stored inline, so a ring slot holds no references and can be copied
+/// while another thread writes it without touching refcounts. Longer strings are truncated on
+/// a scalar boundary.
+struct TelemetryText {
+    static let capacity = 32
+
+    private var length: UInt8 = 0
+    private var bytes: (UInt64, UInt64, UInt64, UInt64) = (0, 0, 0, 0)
+
+    init() {}
+
+    init(_ string: String) {
+        var string = string
+        var storage: (UInt64, UInt64, UInt64, UInt64) = (0, 0, 0, 0)
+        var count = 0
+        string.withUTF8 { utf8 in
+            count = min(utf8.count, Self.capacity)
+            // Don't cut a multi-byte scalar in half.
+            if count < utf8.count {
+                while count > 0 && utf8[count] & 0xC0 == 0x80 {
+                    count -= 1
+                }
+            }
+            guard count > 0, let base = utf8.baseAddress else { return }
+            withUnsafeMutableBytes(of: &storage) { raw in
+                raw.baseAddress?.copyMemory(from: base, byteCount: count)
+            }
+        }
+        bytes = storage
+        length = UInt8(count)
+    }
+
+    var string: String {
+        var copy = bytes
+        return withUnsafeBytes(of: &copy) { raw in
+            String(decoding: raw.prefix(Int(length)), as: UTF8.self)
+        }
+    }
+}
+
+/// One ring entry. Plain values only (see `TelemetryText`).
+struct TelemetrySlot {
+    var kind: UInt8 = 0
+    /// Uptime, nanoseconds.
+    var timestamp: UInt64 = 0
+    var duration: UInt64 = 0
+    /// Ticket of the span's begin record + 1; 0 for plain events.
+    var span: UInt64 = 0
+    var name = TelemetryText()
+    var source = TelemetryText()
+}
+
+/// Fixed-capacity multi-producer ring. Writers claim a ticket with one atomic add and publish
+/// the slot through a per-slot sequence number (a seqlock), so logging never allocates and, on
+/// iOS 18 / macOS 15 and later, never takes a lock. On iOS 17 there are no standard atomics and
+/// the sequencer falls back to short NSLock sections (see `LockedRingSequencer`). When writers
+/// lap the reader, the oldest entries are overwritten and the reader sees them as `.overwritten`.
+///
+/// Sequence values: `2t + 1` while ticket `t` is being written, `2t + 2` once it's published.
+/// A slot's sequence only ever moves forward: a writer claims the slot by CAS from an even
+/// (idle) value below its own, waits out an earlier writer still copying into the slot, and
+/// gives up if a writer a full lap ahead already has it. So slot copies never overlap, and a
+/// lapped ticket reads as `.overwritten` rather than carrying the newer ticket's payload.
+final class TelemetryRing: @unchecked Sendable {
+
+    enum ReadResult {
+        case ready(TelemetrySlot)
+        /// Claimed but not published yet; try again later.
+        case pending
+        /// A later ticket reused the slot.
+        case overwritten
+    }
+
+    let capacity: Int
+    private let mask: Int
+    private let slots: UnsafeMutablePointer<TelemetrySlot>
+    private let sequencer: RingSequencer
+
+    /// `capacity` is rounded up to a power of two.
+    init(capacity: Int) {
+        var size = 2
+        while size < capacity {
+            size <<= 1
+        }
+        self.capacity = size
+        self.mask = size - 1
+        self.slots = .allocate(capacity: size)
+        self.slots.initialize(repeating: TelemetrySlot(), count: size)
+        if #available(iOS 18.0, macOS 15.0, tvOS 18.0, watchOS 11.0, visionOS 2.0, *) {
+            self.sequencer = AtomicRingSequencer(capacity: size)
+        } else {
+            self.sequencer = LockedRingSequencer(capacity: size)
+        }
+    }
+
+    deinit {
+        slots.deinitialize(count: capacity)
+        slots.deallocate()
+    }
+
+    /// The next ticket to be claimed; every ticket below it has a writer.
+    var head: Int { sequencer.head }
+
+    /// Returns the ticket the slot was written under.
+    @discardableResult
+    func append(_ slot: TelemetrySlot) -> Int {
+        let ticket = sequencer.claim()
+        let i = ticket & mask
+        // A writer a lap ahead already owns the slot; this record counts as overwritten.
+        guard sequencer.beginWrite(i, ticket: ticket) else { return ticket }
+        // Deliberately a plain, non-atomic copy: the odd sequence keeps other writers out, and
+        // readers validate their own copy against the sequence afterwards (seqlock).
+        slots[i] = slot
+        sequencer.endWrite(i, ticket: ticket)
+        return ticket
+    }
+
+    func read(_ ticket: Int) -> ReadResult {
+        let i = ticket & mask
+        let published = ticket &* 2 &+ 2
+        let before = sequencer.load(i)
+        if before < published { return .pending }
+        if before > published { return .overwritten }
+        // Non-atomic seqlock copy; may race a writer, which the reload below detects.
+        let slot = slots[i]
+        // A writer that started after `before` invalidates the copy.
+        return sequencer.reload(i) == published ? .ready(slot) : .overwritten
+    }
+}
+
+// MARK: - Sequencers
+
+private protocol RingSequencer: AnyObject, Sendable {
+    var head: Int { get }
+    func claim() -> Int
+    /// Moves the slot to `2t + 1`. False if a later ticket already has it.
+    func beginWrite(_ slot: Int, ticket: Int) -> Bool
+    /// Moves the slot from `2t + 1` to `2t + 2`; never moves it backwards.
+    func endWrite(_ slot: Int, ticket: Int)
+    /// Acquiring load of a slot's sequence, before reading the slot.
+    func load(_ slot: Int) -> Int
+    /// The sequence again, ordered after the slot read.
+    func reload(_ slot: Int) -> Int
+}
+
+/// One relaxed fetch-add to claim, CAS/release/acquire on the slot sequence. Lock-free, except
+/// that a writer that laps a stalled one on the same slot waits for its copy to finish.
+@available(iOS 18.0, macOS 15.0, tvOS 18.0, watchOS 11.0, visionOS 2.0, *)
+private final class AtomicRingSequencer: RingSequencer, @unchecked Sendable {
+
+    private let cursor = Atomic<Int>(0)
+    private let sequences: UnsafeMutablePointer<Atomic<Int>>
+    private let count: Int
+
+    init(capacity: Int) {
+        count = capacity
+        sequences = .allocate(capacity: capacity)
+        for i in 0..<capacity {
+            (sequences + i).initialize(to: Atomic(0))
+        }
+    }
+
+    deinit {
+        sequences.deinitialize(count: count)
+        sequences.deallocate()
+    }
+
+    var head: Int { cursor.load(ordering: .acquiring) }
+
+    func claim() -> Int {
+        cursor.wrappingAdd(1, ordering: .relaxed).oldValue
+    }
+
+    func beginWrite(_ slot: Int, ticket: Int) -> Bool {
+        let writing = ticket &* 2 &+ 1
+        var current = sequences[slot].load(ordering: .acquiring)
+        while true {
+            if current >= writing { return false }
+            if current & 1 == 1 {
+                // An earlier ticket is mid-copy; only happens when writers lap each other.
+                current = sequences[slot].load(ordering: .acquiring)
+                continue
+            }
+            let (exchanged, original) = sequences[slot].compareExchange(
+                expected: current, desired: writing, ordering: .acquiringAndReleasing)
+            if exchanged {
+                atomicMemoryFence(ordering: .releasing)
+                return true
+            }
+            current = original
+        }
+    }
+
+    func endWrite(_ slot: Int, ticket: Int) {
+        _ = sequences[slot].compareExchange(
+            expected: ticket &* 2 &+ 1, desired: ticket &* 2 &+ 2, ordering: .releasing)
+    }
+
+    func load(_ slot: Int) -> Int {
+        sequences[slot].load(ordering: .acquiring)
+    }
+
+    func reload(_ slot: Int) -> Int {
+        atomicMemoryFence(ordering: .acquiring)
+        return sequences[slot].load(ordering: .relaxed)
+    }
+}
+
+/// Same protocol on OS versions without the Synchronization module's atomics (iOS 17).
+/// Not lock-free: every append takes the lock three times (claim, begin, end), each a few
+/// instructions long; the slot copy itself still happens outside it.
+private final class LockedRingSequencer: RingSequencer, @unchecked Sendable {
+
+    private let lock = NSLock()
+    private var cursor = 0
+    private var sequences: [Int]
+
+    init(capacity: Int) {
+        sequences = [Int](repeating: 0, count: capacity)
+    }
+
+    var head: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return cursor
+    }
+
+    func claim() -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        cursor += 1
+        return cursor - 1
+    }
+
+    func beginWrite(_ slot: Int, ticket: Int) -> Bool {
+        let writing = ticket &* 2 &+ 1
+        while true {
+            lock.lock()
+            let current = sequences[slot]
+            if current >= writing {
+                lock.unlock()
+                return false
+            }
+            if current & 1 == 0 {
+                sequences[slot] = writing
+                lock.unlock()
+                return true
+            }
+            // An earlier ticket is mid-copy.
+            lock.unlock()
+        }
+    }
+
+    func endWrite(_ slot: Int, ticket: Int) {
+        lock.lock()
+        if sequences[slot] == ticket &* 2 &+ 1 {
+            sequences[slot] = ticket &* 2 &+ 2
+        }
+        lock.unlock()
+    }
+
+    func load(_ slot: Int) -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return sequences[slot]
+    }
+
+    func reload(_ slot: Int) -> Int {
+        load(slot)
+    }
+}
@@ -0,0 +1,150 @@
+import Foundation
+
+/// A decoded RGBA8 (premultiplied) bitmap. `byteCount` is its real memory cost.
+struct DecodedBitmap: Sendable {
+    let width: Int
+    let height: Int
+    let bytesPerRow: Int
+    let pixels: Data
+
+    var byteCount: Int { pixels.count }
+}
+
+/// Identifies a thumbnail by the source content it came from and the size it was reduced to,
+/// so renaming an asset keeps its thumbnail and changing it invalidates it.
+struct ThumbnailKey: Hashable, Sendable {
+    let contentHash: UInt64
+    let maxPixelSize: Int
+
+    var fileName: String {
+        "\(String(contentHash, radix: 16))-\(maxPixelSize).thumb"
+    }
+}
+
+/// On-disk tier of pre-decoded thumbnails: reading one back is a mapped file read and a copy,
+/// with no image decode. Oldest-touched files are trimmed once `byteLimit` is exceeded.
+///
+/// File layout: "AQTB" | u32 width | u32 height | u32 bytesPerRow | pixels (little-endian).
+/// Blocking I/O; call from background work only.
+final class ThumbnailDiskCache: @unchecked Sendable {
+
+    private static let magic: [UInt8] = Array("AQTB".utf8)
+    private static let headerSize = 16
+
+    let directory: URL
+    let byteLimit: Int
+
+    private let fm = FileManager.default
+    private let lock = NSLock()
+    /// Bytes on disk; nil until first measured.
+    private var usedBytes: Int?
+
+    init(directory: URL, byteLimit: Int = 64 * 1024 * 1024) {
+        self.directory = directory
+        self.byteLimit = byteLimit
+        try? fm.createDirectory(at: directory, withIntermediateDirectories: true)
+    }
+
+    func bitmap(for key: ThumbnailKey) -> DecodedBitmap? {
+        let url = directory.appendingPathComponent(key.fileName)
+        guard let data = try? Data(contentsOf: url, options: .alwaysMapped),
+              data.count >= Self.headerSize,
+              data.prefix(4).elementsEqual(Self.magic) else { return nil }
+
+        let (width, height, bytesPerRow) = data.withUnsafeBytes { raw in
+            (
+                Int(UInt32(littleEndian: raw.loadUnaligned(fromByteOffset: 4, as: UInt32.self))),
+                Int(UInt32(littleEndian: raw.loadUnaligned(fromByteOffset: 8, as: UInt32.self))),
+                Int(UInt32(littleEndian: raw.loadUnaligned(fromByteOffset: 12, as: UInt32.self)))
+            )
+        }
+        guard width > 0, height > 0, bytesPerRow >= width * 4,
+              data.count == Self.headerSize + bytesPerRow * height else { return nil }
+
+        // Touch so trimming treats it as recently used.
+        try? fm.setAttributes([.modificationDate: Date()], ofItemAtPath: url.path)
+
+        return DecodedBitmap(
+            width: width,
+            height: height,
+            bytesPerRow: bytesPerRow,
+            pixels: data.subdata(in: Self.headerSize..<data.count)
+        )
+    }
+
+    func store(_ bitmap: DecodedBitmap, for key: ThumbnailKey) {
+        var out = Data(capacity: Self.headerSize + bitmap.byteCount)
+        out.append(contentsOf: Self.magic)
+        for field in [bitmap.width, bitmap.height, bitmap.bytesPerRow] {
+            withUnsafeBytes(of: UInt32(field).littleEndian) { out.append(contentsOf: $0) }
+        }
+        out.append(bitmap.pixels)
+
+        let url = directory.appendingPathComponent(key.fileName)
+        // Rewriting a key (two loads racing, or an entry trimmed from memory) replaces its file.
+        let previous = (try? fm.attributesOfItem(atPath: url.path)[.size] as? Int) ?? 0
+        guard (try? out.write(to: url, options: .atomic)) != nil else { return }
+
+        lock.lock()
+        let used: Int
+        if let known = usedBytes {
+            used = known - previous + out.count
+        } else {
+            // First measurement already includes the file just written.
+            used = measure()
+        }
+        usedBytes = used
+        lock.unlock()
+
+        if used > byteLimit {
+            trim()
+        }
+    }
+
+    /// Bytes of thumbnails on disk, as tracked for trimming.
+    var bytesUsed: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        if usedBytes == nil { usedBytes = measure() }
+        return usedBytes ?? 0
+    }
+
+    /// Deletes least recently touched thumbnails until usage is under 75% of `byteLimit`.
+    func trim() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let keys: [URLResourceKey] = [.contentModificationDateKey, .fileSizeKey]
+        guard let files = try? fm.contentsOfDirectory(at: directory, includingPropertiesForKeys: keys) else { return }
+        var entries = files.compactMap { url -> (url: URL, date: Date, size: Int)? in
+            guard let values = try? url.resourceValues(forKeys: Set(keys)) else { return nil }
+            return (url, values.contentModificationDate ?? .distantPast, values.fileSize ?? 0)
+        }
+        entries.sort { $0.date < $1.date }
+
+        var used = entries.reduce(0) { $0 + $1.size }
+        let target = byteLimit / 4 * 3
+        for entry in entries where used > target {
+            if (try? fm.removeItem(at: entry.url)) != nil {
+                used -= entry.size
+            }
+        }
+        usedBytes = used
+    }
+
+    func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+        try? fm.removeItem(at: directory)
+        try? fm.createDirectory(at: directory, withIntermediateDirectories: true)
+        usedBytes = 0
+    }
+
+    /// Caller holds `lock`.
+    private func measure() -> Int {
+        let files = (try? fm.contentsOfDirectory(at: directory, includingPropertiesForKeys: [.fileSizeKey])) ?? []
+        return files.reduce(0) { total, url in
+            total + ((try? url.resourceValues(forKeys: [.fileSizeKey]).fileSize) ?? 0)
+        }
+    }
+}
@@ -0,0 +1,47 @@
+import Foundation
+
+/// One warmup task without its work: what the scheduler needs to order and budget it.
+struct WarmupSpec: Sendable {
+    let id: String
+    var priority: WarmupPriority = .normal
+    var cost: Int = 1
+    var prerequisites: [String] = []
+    var level: WarmupLevel = .minimal
+
+    func task(_ work: @escaping @Sendable () async throws -> Void) -> WarmupTask {
+        WarmupTask(id: id, priority: priority, cost: cost, prerequisites: prerequisites, level: level, work: work)
+    }
+}
+
+/// The app's startup warmup graph and budgets. StartupWarmup attaches the real work and
+/// tools/bench/warmup attaches simulated work, so both run the same graph.
+/// Foundation-only so the harness can compile it.
+enum WarmupPlan {
+
+    static let catalog = WarmupSpec(id: "catalog", priority: .high)
+    static let formatters = WarmupSpec(id: "formatters")
+    static let searchIndex = WarmupSpec(id: "search_index", prerequisites: [catalog.id], level: .standard)
+    /// Every level: detail views only show stored summaries, so this is the only place they're made.
+    static let summaries = WarmupSpec(id: "summaries", cost: 2, prerequisites: [catalog.id])
+    static let scenes = WarmupSpec(id: "scenes", priority: .low, cost: 2, prerequisites: [catalog.id], level: .full)
+    static let models = WarmupSpec(id: "models", priority: .low, cost: 2, prerequisites: [scenes.id], level: .full)
+
+    /// In declaration order, which is also report order.
+    static let all = [catalog, formatters, searchIndex, summaries, scenes, models]
+
+    /// Ids that headless runs and debug tooling report time-to-ready for.
+    static let catalogTasks = [catalog.id]
+    static let cacheTasks = [summaries.id, scenes.id, models.id]
+
+    /// Lower levels warm less and keep fewer cores busy doing it.
+    static func budget(for level: WarmupLevel, cores: Int = ProcessInfo.processInfo.activeProcessorCount) -> WarmupBudget {
+        switch level {
+        case .minimal:
+            return WarmupBudget(level: .minimal, cpu: 1)
+        case .standard:
+            return WarmupBudget(level: .standard, cpu: 2)
+        case .full:
+            return WarmupBudget(level: .full, cpu: max(2, cores - 1))
+        }
+    }
+}
@@ -0,0 +1,261 @@
+import Foundation
+
+/// How much warmup the device can afford right now; tasks above it are skipped.
+enum WarmupLevel: Int, Comparable, Sendable {
+    /// Only what the first screen can't draw without.
+    case minimal
+    case standard
+    /// Everything, including heavy 3D assets.
+    case full
+
+    static func < (lhs: WarmupLevel, rhs: WarmupLevel) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+}
+
+enum WarmupPriority: Int, Comparable, Sendable {
+    case low
+    case normal
+    case high
+
+    var taskPriority: TaskPriority {
+        switch self {
+        case .low: return .background
+        case .normal: return .utility
+        case .high: return .userInitiated
+        }
+    }
+
+    static func < (lhs: WarmupPriority, rhs: WarmupPriority) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+}
+
+/// One unit of startup work.
+struct WarmupTask: Sendable {
+    let id: String
+    var priority: WarmupPriority = .normal
+    /// CPU budget units it occupies while running (roughly: cores it keeps busy).
+    var cost: Int = 1
+    /// Ids that must finish first. If one fails or is skipped, so is this.
+    var prerequisites: [String] = []
+    /// Lowest budget level at which this still runs.
+    var level: WarmupLevel = .minimal
+    let work: @Sendable () async throws -> Void
+}
+
+/// Thrown by a task's work when there turns out to be nothing to warm, so the report says
+/// skipped instead of counting it as finished.
+struct WarmupSkipped: Error {}
+
+/// Concurrency and scope for one warmup run.
+struct WarmupBudget: Equatable, Sendable {
+    var level: WarmupLevel
+    /// Sum of `cost` allowed to run at once. A task costlier than this still runs, alone.
+    var cpu: Int
+}
+
+struct WarmupTiming: Codable, Equatable, Sendable {
+    enum Status: String, Codable, Sendable {
+        case pending
+        case running
+        case finished
+        case failed
+        /// Above the budget level, a prerequisite didn't finish, or nothing to warm.
+        case skipped
+        /// Hadn't started when the user interacted, or was low priority and stopped then.
+        case cancelled
+    }
+
+    var id: String
+    var status: Status = .pending
+    /// Offsets from the start of the run, in milliseconds.
+    var startMs: Double?
+    var endMs: Double?
+
+    var durationMs: Double? {
+        guard let startMs, let endMs else { return nil }
+        return endMs - startMs
+    }
+}
+
+struct WarmupReport: Codable, Sendable {
+    var level: String
+    var cpuBudget: Int
+    /// In declaration order.
+    var tasks: [WarmupTiming]
+    var totalMs: Double
+    /// When the user interacted, if they did before the run finished.
+    var interactionMs: Double?
+
+    func timing(_ id: String) -> WarmupTiming? {
+        tasks.first { $0.id == id }
+    }
+
+    /// When the last of `ids` finished, or nil if any of them didn't.
+    func readyMs(_ ids: [String]) -> Double? {
+        var latest = 0.0
+        for id in ids {
+            guard let t = timing(id), t.status == .finished, let end = t.endMs else { return nil }
+            latest = max(latest, end)
+        }
+        return latest
+    }
+
+    var summary: String {
+        tasks.map { t in
+            let time = t.durationMs.map { String(format: "%.1f ms", $0) } ?? "-"
+            return "\(t.id.padding(toLength: 16, withPad: " ", startingAt: 0)) \(t.status.rawValue.padding(toLength: 10, withPad: " ", startingAt: 0)) \(time)"
+        }
+        .joined(separator: "\n")
+    }
+}
+
+/// Runs a graph of warmup tasks once: highest priority first as prerequisites finish, with the
+/// running tasks' total cost held under the CPU budget. `userDidInteract()` cancels everything
+/// not yet started so warmup stops competing with the UI, and cancels running `.low` tasks;
+/// higher-priority running tasks finish on their own. Cancelled work should check
+/// `Task.checkCancellation()` between steps.
+/// Missing or cyclic prerequisites are reported as skipped rather than hanging the run.
+/// Foundation-only; the app's graph is WarmupPlan, its work StartupWarmup, the harness tools/bench/warmup.
+actor WarmupScheduler {
+
+    let budget: WarmupBudget
+
+    private static let deadEnds: Set<WarmupTiming.Status> = [.failed, .skipped, .cancelled]
+
+    private let tasks: [WarmupTask]
+    private var timings: [WarmupTiming]
+    private var indexByID: [String: Int] = [:]
+    private var runningCost = 0
+    /// Handles for running tasks, so interaction can cancel the low-priority ones.
+    private var running: [Int: Task<Void, Error>] = [:]
+    private var interactionMs: Double?
+    private var origin: UInt64?
+    private var finished: WarmupReport?
+
+    init(tasks: [WarmupTask], budget: WarmupBudget) {
+        self.tasks = tasks
+        self.budget = WarmupBudget(level: budget.level, cpu: max(budget.cpu, 1))
+        self.timings = tasks.map { WarmupTiming(id: $0.id) }
+        for (i, task) in tasks.enumerated() where indexByID[task.id] == nil {
+            indexByID[task.id] = i
+        }
+    }
+
+    /// Runs to completion (or cancellation) and returns the timings. Later calls return the
+    /// same report.
+    func run() async -> WarmupReport {
+        if let finished { return finished }
+        guard origin == nil else { return report }
+        origin = DispatchTime.now().uptimeNanoseconds
+
+        for i in tasks.indices where tasks[i].level > budget.level {
+            timings[i].status = .skipped
+        }
+
+        await withTaskGroup(of: (Int, WarmupTiming.Status).self) { group in
+            launchReady(into: &group)
+            while let result = await group.next() {
+                let (i, status) = result
+                timings[i].endMs = elapsedMs()
+                timings[i].status = status
+                running[i] = nil
+                runningCost -= cost(of: i)
+                launchReady(into: &group)
+            }
+        }
+
+        // Whatever is still pending could never become ready.
+        for i in timings.indices where timings[i].status == .pending {
+            timings[i].status = .skipped
+        }
+        let result = report
+        finished = result
+        return result
+    }
+
+    /// Cancels every task that hasn't started.
+    func userDidInteract() {
+        guard finished == nil, interactionMs == nil else { return }
+        interactionMs = origin == nil ? 0 : elapsedMs()
+        for i in timings.indices where timings[i].status == .pending {
+            timings[i].status = .cancelled
+        }
+        for (i, task) in running where tasks[i].priority == .low {
+            task.cancel()
+        }
+    }
+
+    var report: WarmupReport {
+        WarmupReport(
+            level: "\(budget.level)",
+            cpuBudget: budget.cpu,
+            tasks: timings,
+            totalMs: origin == nil ? 0 : elapsedMs(),
+            interactionMs: interactionMs
+        )
+    }
+
+    // MARK: - Scheduling
+
+    private func launchReady(into group: inout TaskGroup<(Int, WarmupTiming.Status)>) {
+        propagateSkips()
+        let ready = tasks.indices
+            .filter { timings[$0].status == .pending && prerequisitesFinished($0) }
+            .sorted { tasks[$0].priority != tasks[$1].priority ? tasks[$0].priority > tasks[$1].priority : $0 < $1 }
+
+        for i in ready {
+            // Lower-priority work may backfill around a task that doesn't fit yet.
+            guard runningCost == 0 || runningCost + cost(of: i) <= budget.cpu else { continue }
+            runningCost += cost(of: i)
+            timings[i].status = .running
+            timings[i].startMs = elapsedMs()
+            // Its own task rather than the group child, so it can be cancelled on its own.
+            let work = Task.detached(priority: tasks[i].priority.taskPriority, operation: tasks[i].work)
+            running[i] = work
+            group.addTask(priority: tasks[i].priority.taskPriority) {
+                do {
+                    try await work.value
+                    return (i, .finished)
+                } catch is WarmupSkipped {
+                    return (i, .skipped)
+                } catch {
+                    return (i, work.isCancelled ? .cancelled : .failed)
+                }
+            }
+        }
+    }
+
+    /// Pending tasks whose prerequisites can no longer finish are skipped, transitively.
+    private func propagateSkips() {
+        var changed = true
+        while changed {
+            changed = false
+            for i in tasks.indices where timings[i].status == .pending {
+                let blocked = tasks[i].prerequisites.contains { id in
+                    guard let p = indexByID[id] else { return true }
+                    return Self.deadEnds.contains(timings[p].status)
+                }
+                if blocked {
+                    timings[i].status = .skipped
+                    changed = true
+                }
+            }
+        }
+    }
+
+    private func prerequisitesFinished(_ i: Int) -> Bool {
+        tasks[i].prerequisites.allSatisfy { id in
+            indexByID[id].map { timings[$0].status == .finished } ?? false
+        }
+    }
+
+    private func cost(of i: Int) -> Int {
+        min(max(tasks[i].cost, 1), budget.cpu)
+    }
+
+    private func elapsedMs() -> Double {
+        Double(DispatchTime.now().uptimeNanoseconds - (origin ?? 0)) / 1_000_000
+    }
+}
@@ -0,0 +1,54 @@
+import Foundation
+
+/// Minimal timing helpers shared by the Linux benchmark harnesses in tools/bench.
+/// Each harness is a `main.swift` compiled together with the Foundation-only app sources it measures.
+enum Bench {
+
+    /// Accumulates results so the optimizer can't drop the measured work.
+    nonisolated(unsafe) static var sink: Int = 0
+
+    static func now() -> UInt64 {
+        DispatchTime.now().uptimeNanoseconds
+    }
+
+    /// Runs `body` once to warm up, then `iterations` times, and prints the mean cost.
+    @discardableResult
+    static func measure(_ label: String, iterations: Int, _ body: () -> Int) -> Double {
+        sink &+= body()
+        let start = now()
+        for _ in 0..<iterations {
+            sink &+= body()
+        }
+        let ns = Double(now() - start) / Double(max(iterations, 1))
+        report(label, ns)
+        return ns
+    }
+
+    /// Times a single run of `body` in milliseconds.
+    static func time<T>(_ body: () throws -> T) rethrows -> (T, Double) {
+        let start = now()
+        let value = try body()
+        return (value, Double(now() - start) / 1_000_000)
+    }
+
+    static func report(_ label: String, _ nsPerOp: Double) {
+        let name = label.padding(toLength: 48, withPad: " ", startingAt: 0)
+        if nsPerOp >= 1_000_000 {
+            print(name + String(format: "%12.3f ms/op", nsPerOp / 1_000_000))
+        } else if nsPerOp >= 1_000 {
+            print(name + String(format: "%12.3f us/op", nsPerOp / 1_000))
+        } else {
+            print(name + String(format: "%12.1f ns/op", nsPerOp))
+        }
+    }
+
+    static func header(_ title: String) {
+        print("")
+        print("== \(title)")
+    }
+
+    /// First positional argument as an Int, or `fallback`.
+    static func intArgument(_ index: Int = 1, default fallback: Int) -> Int {
+        CommandLine.arguments.count > index ? Int(CommandLine.arguments[index]) ?? fallback : fallback
+    }
+}
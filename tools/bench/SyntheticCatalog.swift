@@ -0,0 +1,55 @@
+import Foundation
+
+/// Deterministic fake catalog for benchmarks: same input count always yields the same records.
+enum SyntheticCatalog {
+
+    static let categories = [
+        "Core", "Modules", "Power", "Chipsets", "Devices",
+        "Wearables", "Accessories", "Displays", "Audio", "Storage"
+    ]
+
+    static let words = [
+        "Foundation", "Onyx", "Signal", "Prism", "Vector", "Halo", "Pulse", "Quartz",
+        "Nimbus", "Aurora", "Helix", "Vertex", "Cipher", "Nova", "Lattice", "Zenith",
+        "Tile", "Dock", "Module", "Core", "Link", "Glove", "Array", "Relay"
+    ]
+
+    static func records(count: Int) -> [CatalogRecord] {
+        var rng = SplitMix64(seed: 0xA9_01_2E)
+        var out: [CatalogRecord] = []
+        out.reserveCapacity(count)
+        for i in 0..<count {
+            let a = words[Int(rng.next() % UInt64(words.count))]
+            let b = words[Int(rng.next() % UInt64(words.count))]
+            let category = categories[Int(rng.next() % UInt64(categories.count))]
+            let price = Double(rng.next() % 100_000) / 100.0
+            out.append(CatalogRecord(
+                key: "sku_\(i)",
+                name: "\(a) \(b) \(i)",
+                price: price,
+                imageSystemName: "cube",
+                category: category,
+                description: "\(a) grade \(b.lowercased()) for the \(category.lowercased()) line.",
+                modelName: nil
+            ))
+        }
+        return out
+    }
+}
+
+/// Small deterministic PRNG so runs are comparable across machines.
+struct SplitMix64 {
+    private var state: UInt64
+
+    init(seed: UInt64) {
+        state = seed
+    }
+
+    mutating func next() -> UInt64 {
+        state &+= 0x9E37_79B9_7F4A_7C15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+        z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+        return z ^ (z >> 31)
+    }
+}
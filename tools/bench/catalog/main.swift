@@ -0,0 +1,82 @@
+import Foundation
+
+// Compares the indexed ProductStore against the old dictionary-backed ProductCatalog paths.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Core/Product.swift Core/ProductStore.swift \
+//       tools/bench/BenchSupport.swift tools/bench/SyntheticCatalog.swift \
+//       tools/bench/catalog/main.swift -o /tmp/catalog_bench
+//   /tmp/catalog_bench [sku-count]
+
+/// The pre-index ProductCatalog implementation, kept verbatim as the baseline.
+enum LegacyCatalog {
+    nonisolated(unsafe) static var catalog: [String: Product] = [:]
+
+    static var all: [Product] {
+        catalog
+            .sorted(by: { $0.key < $1.key })
+            .map { $0.value }
+    }
+
+    static var categories: [String] {
+        Array(Set(catalog.values.map { $0.category }))
+            .sorted()
+    }
+
+    static func products(in category: String) -> [Product] {
+        all.filter { $0.category == category }
+    }
+
+    static func key(for product: Product) -> String? {
+        catalog.first(where: { _, p in
+            p.name == product.name &&
+            p.category == product.category &&
+            p.price == product.price &&
+            p.imageSystemName == product.imageSystemName
+        })?.key
+    }
+}
+
+let count = Bench.intArgument(default: 20_000)
+let records = SyntheticCatalog.records(count: count)
+print("catalog bench: \(count) SKUs")
+
+let (store, buildMs) = Bench.time { ProductStore(records: records) }
+print(String(format: "ProductStore build: %.2f ms", buildMs))
+
+LegacyCatalog.catalog = Dictionary(records.map { ($0.key, $0.product) }, uniquingKeysWith: { a, _ in a })
+
+// Probe a spread of products; legacy key(for:) is O(n) so keep its iteration count small.
+// Probes are the store's own instances, the ones views hold and pass back, so they match by UUID.
+// `CatalogRecord.product` makes a fresh UUID per call; those copies take the signature fallback.
+let probeKeys = stride(from: 0, to: count, by: max(count / 64, 1)).map { records[$0].key }
+let probes = probeKeys.compactMap { store.product(for: $0) }
+let copies = stride(from: 0, to: count, by: max(count / 64, 1)).map { records[$0].product }
+let category = SyntheticCatalog.categories[3]
+
+Bench.header("all")
+Bench.measure("legacy  all (sort per access)", iterations: 20) { LegacyCatalog.all.count }
+Bench.measure("store   all", iterations: 100_000) { store.all.count }
+
+Bench.header("categories")
+Bench.measure("legacy  categories", iterations: 20) { LegacyCatalog.categories.count }
+Bench.measure("store   categories", iterations: 100_000) { store.categories.count }
+
+Bench.header("products(in:)")
+Bench.measure("legacy  products(in:)", iterations: 20) { LegacyCatalog.products(in: category).count }
+Bench.measure("store   products(in:)", iterations: 100_000) { store.products(in: category).count }
+
+Bench.header("key(for:)")
+Bench.measure("legacy  key(for:) x\(probes.count)", iterations: 5) {
+    probes.reduce(0) { $0 + (LegacyCatalog.key(for: $1) == nil ? 0 : 1) }
+}
+Bench.measure("store   key(for:) x\(probes.count)", iterations: 10_000) {
+    probes.reduce(0) { $0 + (store.key(for: $1) == nil ? 0 : 1) }
+}
+Bench.measure("store   key(for:) copies x\(copies.count)", iterations: 10_000) {
+    copies.reduce(0) { $0 + (store.key(for: $1) == nil ? 0 : 1) }
+}
+
+Bench.header("price index")
+Bench.measure("store   products(priced: 100...120)", iterations: 10_000) {
+    store.products(priced: 100...120).count
+}
@@ -0,0 +1,147 @@
+import Foundation
+
+// Exercises the platform-independent ImagePipeline with a stub decoder: dedup, cost-bounded LRU,
+// the disk thumbnail tier, and hit-rate / latency counters.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Utilities/LRUCostCache.swift Utilities/CacheSupport.swift \
+//       Utilities/ThumbnailDiskCache.swift Utilities/ImagePipeline.swift \
+//       tools/bench/BenchSupport.swift tools/bench/imagecache/main.swift -o /tmp/imagecache_bench
+//   /tmp/imagecache_bench [request-count]
+// Exits non-zero if any check fails.
+
+/// Pretends every name is a 1024×1024 source; decoding costs real pixel writes plus a fixed delay.
+final class StubDecoder: ImageDecoding, @unchecked Sendable {
+    typealias Image = DecodedBitmap
+
+    private let lock = NSLock()
+    private(set) var decodes = 0
+    private(set) var hashes = 0
+
+    func contentHash(named name: String) -> UInt64? {
+        lock.lock()
+        hashes += 1
+        lock.unlock()
+        return ContentHash.fnv1a64(name)
+    }
+
+    func decode(named name: String, maxPixelSize: Int?) -> DecodedBitmap? {
+        lock.lock()
+        decodes += 1
+        lock.unlock()
+
+        let side = min(maxPixelSize ?? 1024, 1024)
+        var pixels = Data(count: side * side * 4)
+        pixels.withUnsafeMutableBytes { raw in
+            let seed = UInt8(truncatingIfNeeded: name.utf8.count)
+            for i in stride(from: 0, to: raw.count, by: 4) {
+                raw[i] = seed
+            }
+        }
+        usleep(2_000)
+        return DecodedBitmap(width: side, height: side, bytesPerRow: side * 4, pixels: pixels)
+    }
+
+    func makeImage(from bitmap: DecodedBitmap) -> DecodedBitmap? {
+        bitmap
+    }
+}
+
+var failures = 0
+
+func check(_ ok: Bool, _ what: String) {
+    print((ok ? "PASS  " : "FAIL  ") + what)
+    if !ok { failures += 1 }
+}
+
+let requests = Bench.intArgument(default: 5_000)
+let thumb = 128
+let thumbBytes = thumb * thumb * 4
+let dir = FileManager.default.temporaryDirectory.appendingPathComponent("aquire-thumbs-\(UUID().uuidString)", isDirectory: true)
+
+// 1. N concurrent waiters for one key share one decode.
+Bench.header("request coalescing")
+let dedupDecoder = StubDecoder()
+let dedup = ImagePipeline(decoder: dedupDecoder, costLimit: 64 * 1024 * 1024)
+let waiters = 32
+let got = await withTaskGroup(of: Bool.self) { group -> Int in
+    for _ in 0..<waiters {
+        group.addTask { await dedup.image(named: "hero", maxPixelSize: thumb) != nil }
+    }
+    var n = 0
+    for await ok in group {
+        if ok { n += 1 }
+    }
+    return n
+}
+check(got == waiters, "\(waiters) concurrent waiters all got the image")
+check(dedupDecoder.decodes == 1, "one decode for \(waiters) waiters (got \(dedupDecoder.decodes))")
+
+// 2. Cost is decoded bytes and the LRU stays under its byte budget.
+Bench.header("cost-bounded LRU")
+let lruDecoder = StubDecoder()
+let lru = ImagePipeline(decoder: lruDecoder, costLimit: thumbBytes * 10)
+for i in 0..<25 {
+    _ = await lru.image(named: "img\(i)", maxPixelSize: thumb)
+}
+check(lru.memoryCost <= thumbBytes * 10, "memory cost \(lru.memoryCost) <= budget \(thumbBytes * 10)")
+check(lru.memoryCount == 10, "holds exactly the 10 images that fit (got \(lru.memoryCount))")
+check(lru.cachedImage(forKey: ImagePipeline<StubDecoder>.memoryKey(name: "img24", maxPixelSize: thumb)) != nil, "most recent image kept")
+check(lru.cachedImage(forKey: ImagePipeline<StubDecoder>.memoryKey(name: "img0", maxPixelSize: thumb)) == nil, "oldest image evicted")
+
+// 3. Disk tier: a fresh pipeline (cold memory) reads thumbnails back without decoding.
+Bench.header("disk tier")
+let warmDecoder = StubDecoder()
+let warm = ImagePipeline(decoder: warmDecoder, costLimit: 64 * 1024 * 1024, disk: ThumbnailDiskCache(directory: dir))
+for i in 0..<20 {
+    _ = await warm.image(named: "disk\(i)", maxPixelSize: thumb)
+}
+let coldDecoder = StubDecoder()
+let cold = ImagePipeline(decoder: coldDecoder, costLimit: 64 * 1024 * 1024, disk: ThumbnailDiskCache(directory: dir))
+var sameBytes = true
+for i in 0..<20 {
+    let a = warm.cachedImage(forKey: ImagePipeline<StubDecoder>.memoryKey(name: "disk\(i)", maxPixelSize: thumb))
+    let b = await cold.image(named: "disk\(i)", maxPixelSize: thumb)
+    sameBytes = sameBytes && a?.pixels == b?.pixels
+}
+check(coldDecoder.decodes == 0, "cold start served 20 thumbnails from disk with 0 decodes")
+check(sameBytes, "disk round-trip preserves pixels")
+
+// Memory misses after the first don't re-read (re-hash) the source.
+cold.removeAllFromMemory()
+for i in 0..<20 {
+    _ = await cold.image(named: "disk\(i)", maxPixelSize: thumb)
+}
+check(coldDecoder.hashes == 20, "40 memory misses over 20 sources hashed each source once (got \(coldDecoder.hashes))")
+
+// Storing a key that's already on disk replaces its bytes in the usage count, not adds to them.
+let accounting = ThumbnailDiskCache(directory: dir.appendingPathComponent("accounting", isDirectory: true))
+let sample = DecodedBitmap(width: thumb, height: thumb, bytesPerRow: thumb * 4, pixels: Data(count: thumbBytes))
+let sampleKey = ThumbnailKey(contentHash: 1, maxPixelSize: thumb)
+for _ in 0..<5 {
+    accounting.store(sample, for: sampleKey)
+}
+check(accounting.bytesUsed == 16 + thumbBytes, "5 stores of one key count one file (\(accounting.bytesUsed) bytes)")
+let coldStats = cold.counters.snapshot
+print(String(format: "disk hit avg: %.3f ms   decode avg (warm run): %.3f ms",
+             coldStats.averageLoadMs, warm.counters.snapshot.averageLoadMs))
+
+// 4. Skewed workload: hit rate and latency with memory for ~1/5 of the working set.
+Bench.header("workload (\(requests) requests over 500 images, 80/20 skew)")
+let mixed = ImagePipeline(decoder: StubDecoder(), costLimit: thumbBytes * 100, disk: ThumbnailDiskCache(directory: dir))
+var rng = SystemRandomNumberGenerator()
+let mixedStart = Bench.now()
+for _ in 0..<requests {
+    let hot = Int.random(in: 0..<10, using: &rng) < 8
+    let i = hot ? Int.random(in: 0..<100, using: &rng) : Int.random(in: 100..<500, using: &rng)
+    _ = await mixed.image(named: "w\(i)", maxPixelSize: thumb)
+}
+let mixedMs = Double(Bench.now() - mixedStart) / 1_000_000
+let s = mixed.counters.snapshot
+print(String(format: "hit rate %.1f%%  (memory %d, disk %d, miss %d, evictions %d)",
+             s.hitRate * 100, s.memoryHits, s.diskHits, s.misses, s.evictions))
+print(String(format: "avg load %.3f ms, %.1f us/request overall", s.averageLoadMs, mixedMs * 1_000 / Double(requests)))
+
+try? FileManager.default.removeItem(at: dir)
+print("")
+print(failures == 0 ? "all checks passed" : "\(failures) check(s) failed")
+exit(failures == 0 ? 0 : 1)
@@ -0,0 +1,128 @@
+import Foundation
+
+// Crash-recovery and cold-start check for StoreJournal.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Core/OrderStatus.swift Core/StoreJournal.swift \
+//       tools/bench/BenchSupport.swift tools/bench/journal/main.swift -o /tmp/journal_bench
+//   /tmp/journal_bench [order-count]
+// Exits non-zero if recovery is wrong or the cold load misses its budget.
+
+let count = Bench.intArgument(default: 100_000)
+let coldStartBudgetMs = 250.0
+
+let fm = FileManager.default
+let dir = fm.temporaryDirectory.appendingPathComponent("aquire-journal-\(UUID().uuidString)", isDirectory: true)
+var failures = 0
+
+func check(_ ok: Bool, _ what: String) {
+    print((ok ? "PASS  " : "FAIL  ") + what)
+    if !ok { failures += 1 }
+}
+
+func journal() -> StoreJournal {
+    StoreJournal(directory: dir, flushDelay: 0.01, compactionThreshold: 4_096)
+}
+
+print("journal bench: \(count) orders in \(dir.path)")
+
+// 1. Build history, mirroring every mutation into an independent StoreState.
+var expected = StoreState()
+let writer = journal()
+_ = writer.load()
+
+var mutations: [StoreMutation] = []
+mutations.reserveCapacity(count * 2)
+var placed: [UUID] = []
+for i in 0..<count {
+    let id = UUID()
+    placed.append(id)
+    mutations.append(.orderPlaced(id: id, key: "sku_\(i % 500)", date: Date(timeIntervalSinceReferenceDate: Double(i) * 60)))
+    if i % 3 == 0 {
+        mutations.append(.statusAdvanced(id: placed[i / 2], status: .preparing))
+    }
+    if i % 7 == 0 {
+        mutations.append(i % 2 == 0 ? .wishlistAdd(key: "sku_\(i % 97)") : .wishlistRemove(key: "sku_\(i % 97)"))
+    }
+}
+
+Bench.header("record (caller cost, batched writes happen off-thread)")
+let (_, recordMs) = Bench.time {
+    for m in mutations {
+        writer.record(m)
+        expected.apply(m)
+    }
+}
+Bench.report("record x\(mutations.count)", recordMs * 1_000_000 / Double(mutations.count))
+
+let (_, flushMs) = Bench.time { writer.flush() }
+print(String(format: "final flush: %.1f ms", flushMs))
+
+// 2. Cold start from snapshot + journal tail.
+Bench.header("cold start")
+let (loaded, loadMs) = Bench.time { journal().load() }
+print(String(format: "load %d orders: %.1f ms (budget %.0f ms)", loaded.orders.count, loadMs, coldStartBudgetMs))
+check(loaded == expected, "cold load matches replayed state")
+check(loadMs < coldStartBudgetMs, "cold load within budget")
+
+if let size = try? fm.attributesOfItem(atPath: dir.appendingPathComponent("snapshot.bin").path)[.size] as? Int {
+    print(String(format: "snapshot size: %.1f MB (%.1f bytes/order)", Double(size) / 1_048_576, Double(size) / Double(max(count, 1))))
+}
+
+// 3. Torn write: a crash mid-append leaves half a line at the end.
+Bench.header("crash recovery")
+let survivor = journal()
+_ = survivor.load()
+let tail: [StoreMutation] = [.wishlistAdd(key: "torn_a"), .statusAdvanced(id: placed[1], status: .shipped)]
+for m in tail {
+    survivor.record(m)
+    expected.apply(m)
+}
+survivor.flush()
+
+let journalURL = dir.appendingPathComponent("journal.jsonl")
+if let h = try? FileHandle(forWritingTo: journalURL) {
+    _ = try? h.seekToEnd()
+    try? h.write(contentsOf: Data(#"{"seq":99999999,"m":{"wishlistAdd":{"ke"#.utf8))
+    try? h.close()
+}
+let recovered = journal()
+check(recovered.load() == expected, "torn tail is dropped, earlier entries survive")
+
+// The next append must land on a clean line, not glued to the torn bytes.
+recovered.record(.wishlistAdd(key: "after_crash"))
+expected.apply(.wishlistAdd(key: "after_crash"))
+recovered.flush()
+check(journal().load() == expected, "appends after recovery replay cleanly")
+
+// A complete line that doesn't decode (bit rot, a partial sector) mid-journal is skipped;
+// nothing after it is lost and the file is not cut there.
+if let h = try? FileHandle(forWritingTo: journalURL) {
+    _ = try? h.seekToEnd()
+    try? h.write(contentsOf: Data("{\"seq\":\u{0}garbage}\n".utf8))
+    try? h.close()
+}
+let pastCorruption = journal()
+_ = pastCorruption.load()
+pastCorruption.record(.wishlistAdd(key: "after_corrupt"))
+expected.apply(.wishlistAdd(key: "after_corrupt"))
+pastCorruption.flush()
+let corruptSize = (try? Data(contentsOf: journalURL))?.count ?? 0
+check(journal().load() == expected, "a corrupt line mid-journal is skipped, later entries survive")
+check((try? Data(contentsOf: journalURL))?.count == corruptSize, "loading past a corrupt line does not truncate the journal")
+
+// 4. Crash between writing a snapshot and truncating the journal: old lines reappear.
+let staleLines = (try? Data(contentsOf: journalURL)) ?? Data()
+let compactor = journal()
+_ = compactor.load()
+compactor.compact()
+try? staleLines.write(to: journalURL)
+check(journal().load() == expected, "entries already in the snapshot are not applied twice")
+
+// Snapshot status bytes must decode to the status that wrote them.
+check(OrderStatus.allCases.allSatisfy { OrderStatus(code: $0.code) == $0 } && OrderStatus(code: 255) == nil,
+      "status codes round-trip and unknown codes are rejected")
+
+try? fm.removeItem(at: dir)
+print("")
+print(failures == 0 ? "all checks passed" : "\(failures) check(s) failed")
+exit(failures == 0 ? 0 : 1)
@@ -0,0 +1,201 @@
+import Foundation
+
+// Compares the O(1) LRU against the old ModelCache ordering, then checks AsyncLRUCache:
+// shared loads, cost budgets from a custom cost function, and catalog-order prefetch.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Utilities/LRUCostCache.swift Utilities/CacheSupport.swift Utilities/AsyncLRUCache.swift \
+//       Core/Product.swift Core/ProductStore.swift \
+//       tools/bench/BenchSupport.swift tools/bench/SyntheticCatalog.swift \
+//       tools/bench/lrucache/main.swift -o /tmp/lrucache_bench
+//   /tmp/lrucache_bench [operation-count]
+// Exits non-zero if any check fails.
+
+/// The pre-rewrite ModelCache bookkeeping (minus RealityKit), kept as the baseline:
+/// LRU order in an array, `firstIndex(of:)` + `remove(at:)` on every hit, count-only eviction.
+struct LegacyLRU<Value> {
+    private var cache: [String: Value] = [:]
+    private var order: [String] = []
+    let maxEntries: Int
+
+    init(maxEntries: Int) {
+        self.maxEntries = maxEntries
+    }
+
+    mutating func get(_ key: String) -> Value? {
+        guard let entry = cache[key] else { return nil }
+        if let idx = order.firstIndex(of: key) {
+            order.remove(at: idx)
+            order.append(key)
+        }
+        return entry
+    }
+
+    mutating func set(_ value: Value, for key: String) {
+        cache[key] = value
+        if let idx = order.firstIndex(of: key) {
+            order.remove(at: idx)
+        }
+        order.append(key)
+        while order.count > maxEntries {
+            let evictKey = order.removeFirst()
+            cache.removeValue(forKey: evictKey)
+        }
+    }
+}
+
+/// Stand-in for a loaded scene: just its byte size.
+final class FakeScene: @unchecked Sendable {
+    let bytes: Int
+    init(bytes: Int) { self.bytes = bytes }
+}
+
+/// Counts loads per key and sleeps to look like disk + parse work.
+final class LoadLog: @unchecked Sendable {
+    private let lock = NSLock()
+    private var counts: [String: Int] = [:]
+
+    func record(_ key: String) {
+        lock.lock()
+        counts[key, default: 0] += 1
+        lock.unlock()
+    }
+
+    func loads(_ key: String) -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return counts[key, default: 0]
+    }
+
+    var total: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return counts.values.reduce(0, +)
+    }
+}
+
+func sceneCache(log: LoadLog, costLimit: Int, countLimit: Int = .max, delayMicros: UInt32 = 2_000) -> AsyncLRUCache<String, FakeScene> {
+    AsyncLRUCache(costLimit: costLimit, countLimit: countLimit, cost: { $0.bytes }) { key in
+        log.record(key)
+        usleep(delayMicros)
+        // Size is derived from the key so tests can predict the budget: "s<i>" is (i % 4 + 1) MB.
+        let i = Int(key.dropFirst()) ?? 0
+        return FakeScene(bytes: (i % 4 + 1) * 1024 * 1024)
+    }
+}
+
+var failures = 0
+
+func check(_ ok: Bool, _ what: String) {
+    print((ok ? "PASS  " : "FAIL  ") + what)
+    if !ok { failures += 1 }
+}
+
+let operations = Bench.intArgument(default: 200_000)
+
+// 1. Raw get/put cost: the array-ordered LRU scans on every hit, the linked one doesn't.
+for capacity in [8, 64, 512] {
+    Bench.header("get/put, capacity \(capacity), \(operations) ops over \(capacity * 2) keys")
+    let keys = (0..<capacity * 2).map { "model_\($0)" }
+    var rng = SplitMix64(seed: UInt64(capacity))
+    let script = (0..<operations).map { _ in Int(rng.next() % UInt64(keys.count)) }
+
+    let legacyNs = Bench.measure("legacy array-ordered LRU", iterations: 3) {
+        var lru = LegacyLRU<Int>(maxEntries: capacity)
+        var hits = 0
+        for k in script {
+            if lru.get(keys[k]) != nil { hits += 1 } else { lru.set(k, for: keys[k]) }
+        }
+        return hits
+    }
+    let linkedNs = Bench.measure("LRUCostCache", iterations: 3) {
+        var lru = LRUCostCache<String, Int>(countLimit: capacity)
+        var hits = 0
+        for k in script {
+            if lru.value(forKey: keys[k]) != nil { hits += 1 } else { lru.insert(k, forKey: keys[k]) }
+        }
+        return hits
+    }
+    print(String(format: "speedup %.1fx", legacyNs / max(linkedNs, 1)))
+    if capacity >= 64 {
+        check(linkedNs < legacyNs, "O(1) LRU beats the array scan at capacity \(capacity)")
+    }
+}
+
+// 2. Concurrent requests for one key share one load.
+Bench.header("load deduplication")
+let dedupLog = LoadLog()
+let dedup = sceneCache(log: dedupLog, costLimit: .max)
+let waiters = 32
+let got = await withTaskGroup(of: Bool.self) { group -> Int in
+    for _ in 0..<waiters {
+        group.addTask { await dedup.value(for: "s1") != nil }
+    }
+    var n = 0
+    for await ok in group {
+        if ok { n += 1 }
+    }
+    return n
+}
+check(got == waiters, "\(waiters) concurrent waiters all got the scene")
+check(dedupLog.loads("s1") == 1, "one load for \(waiters) waiters (got \(dedupLog.loads("s1")))")
+let dedupStats = dedup.counters.snapshot
+check(dedupStats.coalesced + dedupStats.memoryHits == waiters - 1, "the other \(waiters - 1) callers joined or hit")
+
+// 3. Cost function drives eviction: a 10MB budget holds scenes by bytes, not by count.
+Bench.header("cost-bounded eviction")
+let budgetLog = LoadLog()
+let budget = sceneCache(log: budgetLog, costLimit: 10 * 1024 * 1024, delayMicros: 0)
+for i in 0..<12 {
+    _ = await budget.value(for: "s\(i)")
+}
+let used = await budget.totalCost
+let held = await budget.keysByRecency
+check(used <= 10 * 1024 * 1024, "resident bytes \(used) <= 10MB budget")
+// s11, s10, s9, s8 are 4+3+2+1 MB; the next one back (s7, 4MB) no longer fits.
+check(held == ["s11", "s10", "s9", "s8"], "keeps the most recent scenes that fit (got \(held))")
+check(budget.counters.snapshot.evictions == 8, "8 evictions (got \(budget.counters.snapshot.evictions))")
+
+// 4. Prefetch in catalog order warms the next products before they're opened.
+Bench.header("catalog-order prefetch")
+let store = ProductStore(records: SyntheticCatalog.records(count: 50))
+let current = store.sortedIDs[10]
+let ahead = store.ids(after: current, count: 3)
+check(ahead == Array(store.sortedIDs[11...13]), "ids(after:) follows catalog order")
+check(store.ids(after: store.sortedIDs[49], count: 2) == Array(store.sortedIDs[0...1]), "ids(after:) wraps at the end")
+
+let prefetchLog = LoadLog()
+let warm = sceneCache(log: prefetchLog, costLimit: .max, delayMicros: 20_000)
+let names = ahead.map { "s\($0)" }
+let started = await warm.prefetch(names)
+check(started == names.count, "prefetch started \(names.count) loads")
+check(await warm.prefetch(names) == 0, "repeat prefetch while loading starts nothing")
+// Opening the first one while its prefetch is still running joins it.
+_ = await warm.value(for: names[0])
+while await warm.pendingCount > 0 {
+    await Task.yield()
+}
+for name in names {
+    _ = await warm.value(for: name)
+}
+let warmStats = warm.counters.snapshot
+check(prefetchLog.total == names.count, "each prefetched scene loaded exactly once (got \(prefetchLog.total))")
+check(warmStats.coalesced == 1, "open during prefetch joined the in-flight load")
+check(warmStats.memoryHits == names.count, "every open after prefetch was a memory hit")
+check(warmStats.misses == 0, "no foreground loads")
+
+// 5. Hot path through the actor.
+Bench.header("actor round-trip")
+let hot = sceneCache(log: LoadLog(), costLimit: .max, delayMicros: 0)
+for i in 0..<64 {
+    _ = await hot.value(for: "s\(i)")
+}
+let lookups = 20_000
+let start = Bench.now()
+for i in 0..<lookups {
+    if await hot.cachedValue(for: "s\(i & 63)") != nil { Bench.sink &+= 1 }
+}
+Bench.report("cached lookup via actor", Double(Bench.now() - start) / Double(lookups))
+
+print("")
+print(failures == 0 ? "all checks passed" : "\(failures) check(s) failed")
+exit(failures == 0 ? 0 : 1)
@@ -0,0 +1,81 @@
+import Foundation
+
+// Memory per order and status-transition throughput: columnar OrderHistory vs the old [Order] array.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Core/Product.swift Core/ProductStore.swift Core/OrderStatus.swift Core/OrderHistory.swift \
+//       tools/bench/BenchSupport.swift tools/bench/SyntheticCatalog.swift \
+//       tools/bench/orders/main.swift -o /tmp/orders_bench
+//   /tmp/orders_bench [order-count]
+
+/// Shape of the old `Order` (Models.swift imports SwiftUI, so it's mirrored here).
+struct LegacyOrder: Identifiable {
+    let id = UUID()
+    let product: Product
+    let date: Date
+    var status: OrderStatus
+}
+
+/// Resident set size in bytes (Linux /proc; 0 elsewhere).
+func residentBytes() -> Int {
+    guard let statm = try? String(contentsOfFile: "/proc/self/statm", encoding: .utf8) else { return 0 }
+    let fields = statm.split(separator: " ")
+    guard fields.count > 1, let pages = Int(fields[1]) else { return 0 }
+    return pages * Int(sysconf(Int32(_SC_PAGESIZE)))
+}
+
+let count = Bench.intArgument(default: 100_000)
+let store = ProductStore(records: SyntheticCatalog.records(count: 2_000))
+print("orders bench: \(count) orders over \(store.count) products")
+
+// Build the legacy array the way placeOrder used to (insert at 0 is O(n); skip that here
+// so memory, not setup time, is what's compared).
+Bench.header("memory")
+var rss = residentBytes()
+var legacy: [LegacyOrder] = []
+legacy.reserveCapacity(count)
+for i in 0..<count {
+    legacy.append(LegacyOrder(product: store.products[i % store.count], date: Date(), status: .processing))
+}
+let legacyBytes = residentBytes() - rss
+
+rss = residentBytes()
+let history = OrderHistory()
+history.reserveCapacity(count)
+for i in 0..<count {
+    history.append(id: UUID(), productID: CatalogID(i % store.count), date: Date())
+}
+let columnarBytes = residentBytes() - rss
+
+print("inline stride   legacy Order: \(MemoryLayout<LegacyOrder>.stride) B   columnar row: \(MemoryLayout<UUID>.stride + MemoryLayout<CatalogID>.stride + MemoryLayout<Date>.stride + 1) B (+ id map entry)")
+if legacyBytes > 0 && columnarBytes > 0 {
+    print(String(format: "RSS per order   legacy: %.1f B   columnar: %.1f B", Double(legacyBytes) / Double(count), Double(columnarBytes) / Double(count)))
+}
+
+// Transitions: legacy has no id index, so each advance is a linear search plus one @Published write.
+Bench.header("status transitions")
+let batch = stride(from: 0, to: count, by: max(count / 1_000, 1)).map { history.ids[$0] }
+let legacyBatch = stride(from: 0, to: count, by: max(count / 1_000, 1)).map { legacy[$0].id }
+
+var legacyPublishes = 0
+let (_, legacyMs) = Bench.time {
+    for id in legacyBatch {
+        if let i = legacy.firstIndex(where: { $0.id == id }), let next = legacy[i].status.next {
+            legacy[i].status = next
+            legacyPublishes += 1
+        }
+    }
+}
+print(String(format: "legacy   advance %d by id: %9.2f ms, %d publishes", legacyBatch.count, legacyMs, legacyPublishes))
+
+let (changed, batchMs) = Bench.time { history.advance(batch).count }
+print(String(format: "columnar advance %d by id: %9.2f ms, 1 publish", changed, batchMs))
+
+let (moved, allMs) = Bench.time { history.advanceAll(from: .processing).count }
+print(String(format: "columnar advanceAll(from: .processing) %d rows: %.2f ms (%.1f M rows/s)", moved, allMs, Double(moved) / max(allMs, 0.001) / 1_000))
+
+Bench.header("paging")
+Bench.measure("page(limit: 50) newest", iterations: 10_000) { history.page(limit: 50).rows.count }
+let deep = history.page(before: nil, limit: count / 2).next
+Bench.measure("page(before: middle, limit: 50)", iterations: 10_000) { history.page(before: deep, limit: 50).rows.count }
+
+Bench.sink &+= legacy.count
@@ -0,0 +1,58 @@
+import Foundation
+
+// Measures ProductSearchIndex query latency against the old BrowseView lowercase scan.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Core/Product.swift Core/ProductStore.swift Core/ProductSearch.swift \
+//       tools/bench/BenchSupport.swift tools/bench/SyntheticCatalog.swift \
+//       tools/bench/search/main.swift -o /tmp/search_bench
+//   /tmp/search_bench [sku-count]
+
+/// The pre-index BrowseView.filtered body, kept verbatim as the baseline.
+func legacyFilter(_ products: [Product], _ searchText: String) -> [Product] {
+    let q = searchText.trimmingCharacters(in: .whitespacesAndNewlines).lowercased()
+    guard !q.isEmpty else { return products }
+    return products.filter {
+        $0.name.lowercased().contains(q) ||
+        $0.category.lowercased().contains(q)
+    }
+}
+
+let count = Bench.intArgument(default: 100_000)
+let store = ProductStore(records: SyntheticCatalog.records(count: count))
+print("search bench: \(count) products")
+
+let (index, buildMs) = Bench.time { ProductSearchIndex(store: store) }
+print(String(format: "ProductSearchIndex build: %.1f ms", buildMs))
+
+let queries = ["o", "on", "onyx", "onyx ti", "prism mod", "chipsets", "quartz relay 42", "nothing-matches"]
+
+Bench.header("legacy scan (per keystroke)")
+for q in ["on", "onyx"] {
+    Bench.measure("legacy  \"\(q)\"", iterations: 5) { legacyFilter(store.all, q).count }
+}
+
+Bench.header("fresh query, top 50")
+var worst = 0.0
+for q in queries {
+    worst = max(worst, Bench.measure("index   \"\(q)\"", iterations: 200) { index.search(q, limit: 50).count })
+}
+
+Bench.header("incremental typing (refine previous match set)")
+let typed = "onyx tile"
+let steps = (1...typed.count).map { ProductSearchIndex.tokenize(String(typed.prefix($0))) }
+Bench.measure("refine  \"\(typed)\" (\(steps.count) keystrokes)", iterations: 200) {
+    var previous: [String] = []
+    var matches: [SearchMatch] = []
+    var total = 0
+    for tokens in steps where !tokens.isEmpty {
+        matches = ProductSearchIndex.extends(tokens, previous)
+            ? index.refine(matches, from: previous, to: tokens)
+            : index.matches(for: tokens)
+        previous = tokens
+        total += index.rank(matches, limit: 50).count
+    }
+    return total
+}
+
+print("")
+print(String(format: "worst fresh query: %.3f ms (target < 1 ms)", worst / 1_000_000))
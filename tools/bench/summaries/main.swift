@@ -0,0 +1,247 @@
+import Foundation
+
+// Summary engine: what a product detail view pays for its summary before (recompute on every
+// view) and after (stored lookup); batch throughput and per-item latency for the heuristic
+// backend and a stand-in local model at several concurrency limits; in-flight dedup, the
+// concurrency bound, disk persistence and key invalidation.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Utilities/CacheSupport.swift Utilities/SummaryEngine.swift \
+//       Core/Product.swift Core/ProductStore.swift \
+//       tools/bench/BenchSupport.swift tools/bench/SyntheticCatalog.swift \
+//       tools/bench/summaries/main.swift -o /tmp/summaries_bench
+//   /tmp/summaries_bench [sku-count]
+// Exits non-zero if any check fails.
+
+var failures = 0
+
+func check(_ ok: Bool, _ what: String) {
+    print((ok ? "PASS  " : "FAIL  ") + what)
+    if !ok { failures += 1 }
+}
+
+/// Keeps a core busy for `us` microseconds; model inference is compute, not waiting.
+func spin(us: Double) {
+    let end = Bench.now() + UInt64(us * 1_000)
+    var x = 0
+    while Bench.now() < end {
+        x &+= 1
+    }
+    Bench.sink &+= x
+}
+
+/// Backend calls and peak concurrency, shared by the wrappers below.
+final class Probe: @unchecked Sendable {
+    private let lock = NSLock()
+    private(set) var calls = 0
+    private(set) var peak = 0
+    private var active = 0
+
+    func begin() {
+        lock.lock()
+        calls += 1
+        active += 1
+        peak = max(peak, active)
+        lock.unlock()
+    }
+
+    func end() {
+        lock.lock()
+        active -= 1
+        lock.unlock()
+    }
+}
+
+/// Stand-in for an on-device model: a prefill cost per input token, a decode cost per output
+/// token, and an extractive summary (the description's most frequent content words) so the
+/// output depends on the input like a real model's would.
+struct StandInModelBackend: SummaryBackend {
+    let identity = "standin-v1"
+    var prefillUsPerToken = 40.0
+    var decodeUsPerToken = 250.0
+    var maxOutputTokens = 16
+
+    func summarize(name: String, description: String) async throws -> String {
+        let tokens = (name + " " + description)
+            .lowercased()
+            .split { !$0.isLetter && !$0.isNumber }
+        spin(us: Double(tokens.count) * prefillUsPerToken)
+
+        var counts: [Substring: Int] = [:]
+        for token in tokens where token.count > 3 {
+            counts[token, default: 0] += 1
+        }
+        let picked = counts.sorted { $0.value != $1.value ? $0.value > $1.value : $0.key < $1.key }
+            .prefix(maxOutputTokens)
+            .map { String($0.key) }
+        spin(us: Double(picked.count + 4) * decodeUsPerToken)
+        return "\(name): " + picked.joined(separator: ", ")
+    }
+}
+
+/// Counts calls and concurrency around any backend; optionally fails some requests.
+struct ProbedBackend<Base: SummaryBackend>: SummaryBackend {
+    let base: Base
+    let probe: Probe
+    var failing: Set<String> = []
+
+    var identity: String { base.identity }
+
+    func summarize(name: String, description: String) async throws -> String {
+        probe.begin()
+        defer { probe.end() }
+        if failing.contains(name) { throw CancellationError() }
+        return try await base.summarize(name: name, description: description)
+    }
+}
+
+/// Blocks the calling thread on async work; the harness is a plain top-level script.
+final class Blocking<T>: @unchecked Sendable {
+    private let done = DispatchSemaphore(value: 0)
+    private var value: T?
+
+    init(_ body: @escaping @Sendable () async -> T) {
+        Task {
+            self.value = await body()
+            self.done.signal()
+        }
+    }
+
+    func wait() -> T {
+        done.wait()
+        return value!
+    }
+}
+
+func block<T>(_ body: @escaping @Sendable () async -> T) -> T {
+    Blocking(body).wait()
+}
+
+let skuCount = Bench.intArgument(default: 5_000)
+let records = SyntheticCatalog.records(count: skuCount)
+let requests = records.map { SummaryRequest(name: $0.name, description: $0.description) }
+let cores = ProcessInfo.processInfo.activeProcessorCount
+
+// 1. What a detail view pays per appearance.
+Bench.header("detail view, \(skuCount) products")
+var i = 0
+Bench.measure("legacy: heuristic on every view", iterations: 100_000) {
+    i = (i + 1) % requests.count
+    return HeuristicSummaryBackend.summary(name: requests[i].name, description: requests[i].description).utf8.count
+}
+let warm = SummaryEngine(backend: HeuristicSummaryBackend())
+let heuristicReport = block { await warm.summarizeAll(requests) }
+Bench.measure("engine: cachedSummary lookup", iterations: 100_000) {
+    i = (i + 1) % requests.count
+    return warm.cachedSummary(for: requests[i])?.utf8.count ?? 0
+}
+check(heuristicReport.generated == requests.count && warm.store.count == requests.count, "whole catalog precomputed (\(warm.store.count))")
+check(requests.allSatisfy { warm.cachedSummary(for: $0) == HeuristicSummaryBackend.summary(name: $0.name, description: $0.description) }, "stored summaries match the old output")
+
+// 2. Batch throughput and latency per backend and concurrency limit.
+func batch<B: SummaryBackend>(_ label: String, _ backend: B, _ items: [SummaryRequest]) {
+    Bench.header("\(label), \(items.count) items")
+    var limits = [1, 2, 4, cores].filter { $0 <= cores }
+    limits = Array(Set(limits)).sorted()
+    for limit in limits {
+        let probe = Probe()
+        let engine = SummaryEngine(backend: ProbedBackend(base: backend, probe: probe), maxConcurrent: limit)
+        let report = block { await engine.summarizeAll(items) }
+        let line = "maxConcurrent \(limit)".padding(toLength: 18, withPad: " ", startingAt: 0)
+        print(line + String(format: "%9.0f items/s   p50 %7.3f ms   p95 %7.3f ms   total %8.1f ms",
+                            report.generatedPerSecond, report.percentileMs(0.5), report.percentileMs(0.95), report.totalMs))
+        check(probe.peak <= limit && report.generated == items.count && probe.calls == items.count,
+              "\(label) at \(limit): \(probe.calls) calls, peak \(probe.peak) in flight")
+    }
+}
+
+batch("heuristic backend", HeuristicSummaryBackend(), requests)
+batch("stand-in local model", StandInModelBackend(), Array(requests.prefix(min(skuCount, 400))))
+
+// 3. In-flight dedup: a burst of views for one product while it's still generating.
+Bench.header("dedup")
+do {
+    let probe = Probe()
+    let engine = SummaryEngine(backend: ProbedBackend(base: StandInModelBackend(), probe: probe))
+    let target = requests[0]
+    let results = block {
+        await withTaskGroup(of: String?.self, returning: [String?].self) { group in
+            for _ in 0..<64 {
+                group.addTask { await engine.summary(for: target) }
+            }
+            var out: [String?] = []
+            for await r in group { out.append(r) }
+            return out
+        }
+    }
+    let stats = engine.counters.snapshot
+    check(probe.calls == 1, "64 concurrent requests, \(probe.calls) backend call")
+    check(Set(results).count == 1 && results[0] != nil, "everyone gets the same summary")
+    check(stats.misses == 1 && stats.coalesced + stats.memoryHits == 63, "1 miss, \(stats.coalesced) joined, \(stats.memoryHits) stored hits")
+
+    let dupes = Array(repeating: requests[1], count: 10) + Array(requests[2..<12])
+    let dupeProbe = Probe()
+    let dupeEngine = SummaryEngine(backend: ProbedBackend(base: HeuristicSummaryBackend(), probe: dupeProbe))
+    let report = block { await dupeEngine.summarizeAll(dupes) }
+    check(dupeProbe.calls == 11 && report.joined == 9, "duplicates in a batch share one call (\(dupeProbe.calls) calls, \(report.joined) joined)")
+}
+
+// 4. Failures aren't stored and don't stop the batch.
+Bench.header("failures")
+do {
+    let probe = Probe()
+    let failing = Set(requests.prefix(20).map(\.name))
+    let engine = SummaryEngine(backend: ProbedBackend(base: HeuristicSummaryBackend(), probe: probe, failing: failing))
+    let items = Array(requests.prefix(100))
+    let report = block { await engine.summarizeAll(items) }
+    check(report.failed == 20 && report.generated == 80, "20 failed, 80 generated")
+    check(engine.store.count == 80 && engine.cachedSummary(for: items[0]) == nil, "failures leave no entry, so they're retried next time")
+}
+
+// 5. Persistence and invalidation.
+Bench.header("persistence")
+do {
+    let dir = FileManager.default.temporaryDirectory.appendingPathComponent("summaries-bench-\(ProcessInfo.processInfo.processIdentifier)")
+    defer { try? FileManager.default.removeItem(at: dir) }
+    let file = dir.appendingPathComponent("summaries.json")
+    let items = Array(requests.prefix(1_000))
+
+    let first = SummaryEngine(backend: HeuristicSummaryBackend(), store: SummaryStore(fileURL: file))
+    _ = block { await first.summarizeAll(items) }
+    let bytes = (try? Data(contentsOf: file))?.count ?? 0
+
+    let probe = Probe()
+    let (relaunched, loadMs) = Bench.time {
+        SummaryEngine(backend: ProbedBackend(base: HeuristicSummaryBackend(), probe: probe), store: SummaryStore(fileURL: file))
+    }
+    print(String(format: "store: %d entries, %d bytes, loaded in %.2f ms", relaunched.store.count, bytes, loadMs))
+    let again = block { await relaunched.summarizeAll(items) }
+    check(again.cached == items.count && probe.calls == 0, "relaunch serves everything from disk (\(again.cached) cached, \(probe.calls) calls)")
+
+    let edited = SummaryRequest(name: items[0].name, description: items[0].description + " Now with a longer battery.")
+    check(relaunched.cachedSummary(for: edited) == nil, "editing the description invalidates the summary")
+    let other = SummaryEngine(backend: StandInModelBackend(), store: SummaryStore(fileURL: file))
+    check(other.cachedSummary(for: items[0]) == nil, "a different backend never sees the heuristic's summaries")
+
+    // Single requests don't rewrite the file each time; they share one delayed write.
+    let single = SummaryEngine(backend: HeuristicSummaryBackend(), store: SummaryStore(fileURL: file, flushDelay: 0.05))
+    let fresh = requests.dropFirst(items.count).prefix(20)
+    let before = (try? Data(contentsOf: file)) ?? Data()
+    _ = block {
+        for request in fresh {
+            _ = await single.summary(for: request)
+        }
+        return 0
+    }
+    let unchanged = (try? Data(contentsOf: file)) == before
+    usleep(200_000)
+    let reloaded = SummaryStore(fileURL: file)
+    check(unchanged && fresh.allSatisfy { reloaded.summary(for: single.key(for: $0)) != nil }, "20 single summaries saved by one debounced flush")
+
+    relaunched.store.retain(only: Set(items.prefix(10).map(relaunched.key(for:))))
+    relaunched.store.flush()
+    check(SummaryStore(fileURL: file).count == 10, "retain(only:) prunes removed products on disk")
+}
+
+print("")
+print(failures == 0 ? "all checks passed" : "\(failures) check(s) failed")
+exit(failures == 0 ? 0 : 1)
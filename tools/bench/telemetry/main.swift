@@ -0,0 +1,241 @@
+import Foundation
+
+// Per-event logging cost and multithreaded contention for TelemetryRecorder, against the old
+// insert-at-0 array and a locked append; plus ring correctness (no torn or lost records while
+// a reader samples concurrently), span histograms and export round-trips.
+// Usage (from the repo root, Linux or macOS; needs the Synchronization module, Swift 6):
+//   swiftc -O Utilities/TelemetryRing.swift Utilities/TelemetryRecorder.swift \
+//       tools/bench/BenchSupport.swift tools/bench/telemetry/main.swift -o /tmp/telemetry_bench
+//   /tmp/telemetry_bench [events-per-thread]
+// Exits non-zero if any check fails.
+
+/// The old Telemetry storage, minus @MainActor/@Published: newest-first array, insert at 0.
+final class LegacyTelemetry {
+    struct Event {
+        let id = UUID()
+        let message: String
+        let source: String
+        let date: Date
+    }
+
+    private(set) var events: [Event] = []
+
+    func log(_ message: String, source: String = "app") {
+        events.insert(Event(message: message, source: source, date: Date()), at: 0)
+    }
+}
+
+/// What "just put a lock around it" would cost.
+final class LockedTelemetry: @unchecked Sendable {
+    private let lock = NSLock()
+    private var events: [(String, String, UInt64)] = []
+
+    func log(_ message: String, source: String = "app") {
+        let now = DispatchTime.now().uptimeNanoseconds
+        lock.lock()
+        events.append((message, source, now))
+        lock.unlock()
+    }
+}
+
+var failures = 0
+
+func check(_ ok: Bool, _ what: String) {
+    print((ok ? "PASS  " : "FAIL  ") + what)
+    if !ok { failures += 1 }
+}
+
+let perThread = Bench.intArgument(default: 200_000)
+let threads = max(2, min(8, ProcessInfo.processInfo.activeProcessorCount))
+let names = (0..<64).map { "event_\($0)" }
+
+// 1. Single-thread cost per event.
+Bench.header("single thread")
+let legacyCount = min(perThread, 20_000)
+let legacy = LegacyTelemetry()
+let (_, legacyMs) = Bench.time {
+    for i in 0..<legacyCount {
+        legacy.log(names[i & 63], source: "bench")
+    }
+}
+Bench.report("legacy insert(at: 0), \(legacyCount) events", legacyMs * 1_000_000 / Double(legacyCount))
+
+let single = TelemetryRecorder(capacity: 1 << 16)
+let (_, logMs) = Bench.time {
+    for i in 0..<perThread {
+        single.log(names[i & 63], source: "bench")
+    }
+}
+let logNs = logMs * 1_000_000 / Double(perThread)
+Bench.report("ring log, \(perThread) events", logNs)
+
+let (_, spanMs) = Bench.time {
+    for i in 0..<perThread / 2 {
+        single.end(single.begin(names[i & 63], source: "bench"))
+    }
+}
+Bench.report("ring begin+end pair", spanMs * 1_000_000 / Double(perThread / 2))
+check(logNs < 1_000, "log costs under 1us per event")
+
+// 2. Contention: every thread hammering the same recorder.
+Bench.header("\(threads) threads x \(perThread) events")
+let locked = LockedTelemetry()
+let (_, lockedMs) = Bench.time {
+    DispatchQueue.concurrentPerform(iterations: threads) { t in
+        for i in 0..<perThread {
+            locked.log(names[(i + t) & 63], source: "bench")
+        }
+    }
+}
+Bench.report("NSLock + append", lockedMs * 1_000_000 / Double(threads * perThread))
+
+let total = threads * perThread
+let shared = TelemetryRecorder(capacity: total)
+let sources = (0..<threads).map { "t\($0)" }
+
+// A reader samples throughout, like the UI would, to shake out torn reads.
+let stop = DispatchSemaphore(value: 0)
+final class ReaderStats: @unchecked Sendable {
+    var samples = 0
+    var torn = 0
+}
+let readerStats = ReaderStats()
+let reader = Thread {
+    while stop.wait(timeout: .now() + .milliseconds(5)) == .timedOut {
+        let snap = shared.snapshot()
+        readerStats.samples += 1
+        for r in snap.recent.prefix(32) where !(r.name.hasPrefix("event_") && r.source.hasPrefix("t")) {
+            readerStats.torn += 1
+        }
+    }
+}
+reader.start()
+
+let (_, ringMs) = Bench.time {
+    DispatchQueue.concurrentPerform(iterations: threads) { t in
+        for i in 0..<perThread {
+            shared.log(names[(i + t) & 63], source: sources[t])
+        }
+    }
+}
+stop.signal()
+while !reader.isFinished {
+    usleep(1_000)
+}
+Bench.report("ring log", ringMs * 1_000_000 / Double(total))
+print(String(format: "speedup vs lock: %.1fx   reader took %d samples", lockedMs / max(ringMs, 0.001), readerStats.samples))
+
+let sharedSnap = shared.snapshot()
+check(sharedSnap.recorded == total, "every event claimed a ticket (\(sharedSnap.recorded) / \(total))")
+check(sharedSnap.dropped == 0, "nothing dropped when capacity covers the run")
+check(readerStats.torn == 0, "no torn records seen by the concurrent reader")
+
+var perSource = [String: Int]()
+for r in shared.records() {
+    perSource[r.source, default: 0] += 1
+}
+check(perSource.count == threads && perSource.values.allSatisfy { $0 == perThread }, "each thread's events all present exactly once")
+
+// 2b. Writers lapping each other on a tiny ring: every published ticket carries its own
+// payload, nothing is torn, and no slot is left pending once the writers are done.
+Bench.header("lapping writers")
+do {
+    let ring = TelemetryRing(capacity: 16)
+    let lapsPerThread = min(perThread, 50_000)
+    final class Written: @unchecked Sendable {
+        let lock = NSLock()
+        var byTicket: [Int: UInt64] = [:]
+    }
+    let written = Written()
+    DispatchQueue.concurrentPerform(iterations: threads) { t in
+        var mine: [(Int, UInt64)] = []
+        mine.reserveCapacity(lapsPerThread)
+        for i in 0..<lapsPerThread {
+            let id = UInt64(t) << 32 | UInt64(i)
+            var slot = TelemetrySlot()
+            slot.timestamp = id
+            slot.duration = id ^ 0x5A5A_5A5A_5A5A_5A5A
+            slot.name = TelemetryText("w\(id)")
+            mine.append((ring.append(slot), id))
+        }
+        written.lock.lock()
+        for (ticket, id) in mine {
+            written.byTicket[ticket] = id
+        }
+        written.lock.unlock()
+    }
+    let head = ring.head
+    var pending = 0
+    var wrong = 0
+    var ready = 0
+    for ticket in max(0, head - ring.capacity * 4)..<head {
+        switch ring.read(ticket) {
+        case .ready(let slot):
+            ready += 1
+            let id = written.byTicket[ticket]
+            if slot.timestamp != id || slot.duration != slot.timestamp ^ 0x5A5A_5A5A_5A5A_5A5A || slot.name.string != "w\(slot.timestamp)" {
+                wrong += 1
+            }
+        case .pending:
+            pending += 1
+        case .overwritten:
+            break
+        }
+    }
+    check(head == threads * lapsPerThread, "every append claimed a ticket")
+    check(pending == 0, "no ticket left pending after writers finish (\(pending))")
+    check(wrong == 0 && ready > 0, "\(ready) readable tickets all carry their own, untorn payload")
+}
+
+// 3. Spans and histograms.
+Bench.header("spans")
+let spans = TelemetryRecorder(capacity: 4_096)
+for i in 0..<100 {
+    let span = spans.begin("scene_load", source: "model\(i)")
+    usleep(i < 90 ? 100 : 5_000)
+    spans.end(span)
+}
+spans.measure("catalog_warmup", source: "startup") { _ = usleep(1_000) }
+let spanSnap = spans.snapshot()
+let scene = spanSnap.histograms["scene_load"]
+check(scene?.count == 100, "100 scene_load spans in the histogram")
+check((scene?.percentileMs(0.5) ?? 0) < 1, "p50 reflects the fast loads (\(scene?.percentileMs(0.5) ?? 0) ms)")
+check((scene?.percentileMs(0.95) ?? 0) >= 5, "p95 reflects the slow tail (\(scene?.percentileMs(0.95) ?? 0) ms)")
+check(spanSnap.histograms["catalog_warmup"]?.count == 1, "measure {} records a span")
+let ends = spans.records().filter { $0.kind == .end }
+let begins = Dictionary(uniqueKeysWithValues: spans.records().filter { $0.kind == .begin }.map { ($0.sequence, $0) })
+check(ends.allSatisfy { begins[$0.span ?? -1]?.name == $0.name }, "end records point at their begin record")
+
+// 4. Overflow: a small ring keeps the newest records and counts the rest as dropped.
+Bench.header("overflow")
+let small = TelemetryRecorder(capacity: 1_024, recentLimit: 50)
+for i in 0..<10_000 {
+    small.log("e\(i)")
+}
+let smallSnap = small.snapshot()
+check(smallSnap.dropped == 10_000 - 1_024, "dropped \(smallSnap.dropped) = overwritten before sampling")
+check(smallSnap.recent.first?.name == "e9999", "recent list is newest first")
+check(small.records().count == 1_024, "ring holds the last 1024")
+
+// 5. Exports.
+Bench.header("export")
+let exported = spans.records()
+let binary = spans.export(.binary)
+let jsonl = spans.export(.jsonLines)
+check(TelemetryCodec.decode(binary) == exported, "binary round-trips (\(binary.count) bytes)")
+check(jsonl.split(separator: 0x0A).count == exported.count, "one JSON line per record (\(jsonl.count) bytes)")
+let firstLine = jsonl.split(separator: 0x0A).first.map { Data($0) }
+check(firstLine.flatMap { try? JSONDecoder().decode(TelemetryRecord.self, from: $0) } == exported.first, "JSON lines decode back to records")
+
+// 6. Inline text.
+let long = "ünïcödé-" + String(repeating: "é", count: 40)
+let truncated = TelemetryText(long).string
+check(truncated.utf8.count <= TelemetryText.capacity && long.hasPrefix(truncated), "long names truncate on a scalar boundary")
+
+// 7. Clear.
+spans.clear()
+check(spans.snapshot().recorded == 0 && spans.records().isEmpty, "clear forgets history")
+
+print("")
+print(failures == 0 ? "all checks passed" : "\(failures) check(s) failed")
+exit(failures == 0 ? 0 : 1)
@@ -0,0 +1,196 @@
+import Foundation
+
+// Drives the thumbnail pipeline (manifest, hashing, worker pool, report) with a stub renderer.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Utilities/CacheSupport.swift tools/thumbnails/ThumbnailPipeline.swift \
+//       tools/bench/BenchSupport.swift tools/bench/thumbnails/main.swift -o /tmp/thumbnails_bench
+//   /tmp/thumbnails_bench [model-count]
+// Exits non-zero if any check fails.
+
+/// Tracks loads, sizes and peak concurrency across all stub renderers.
+final class RenderLog: @unchecked Sendable {
+    private let lock = NSLock()
+    private(set) var loads = 0
+    private(set) var renderedSizes: [Int] = []
+    private(set) var renderers = 0
+    private(set) var peakConcurrent = 0
+    private var active = 0
+
+    func makeRenderer() {
+        lock.lock()
+        renderers += 1
+        lock.unlock()
+    }
+
+    func begin(sizes: [Int]) {
+        lock.lock()
+        loads += 1
+        renderedSizes += sizes
+        active += 1
+        peakConcurrent = max(peakConcurrent, active)
+        lock.unlock()
+    }
+
+    func end() {
+        lock.lock()
+        active -= 1
+        lock.unlock()
+    }
+
+    func reset() {
+        lock.lock()
+        loads = 0
+        renderedSizes = []
+        renderers = 0
+        peakConcurrent = 0
+        lock.unlock()
+    }
+}
+
+/// Sleeps for a fixed "load" plus a little per size, and emits fake PNG bytes.
+/// Models whose name contains "broken" fail to load.
+struct StubRenderer: ThumbnailRendering {
+    static let identity = "stub-v1"
+    nonisolated(unsafe) static var log = RenderLog()
+    nonisolated(unsafe) static var loadMicros: UInt32 = 4_000
+
+    init() {
+        Self.log.makeRenderer()
+    }
+
+    func render(modelAt url: URL, sizes: [Int]) throws -> [Int: Data] {
+        if url.lastPathComponent.contains("broken") {
+            throw ThumbnailError.unreadable(url)
+        }
+        Self.log.begin(sizes: sizes)
+        defer { Self.log.end() }
+        usleep(Self.loadMicros + UInt32(sizes.count) * 200)
+        var out: [Int: Data] = [:]
+        for size in sizes {
+            out[size] = Data("PNG \(url.lastPathComponent) \(size)".utf8)
+        }
+        return out
+    }
+}
+
+var failures = 0
+
+func check(_ ok: Bool, _ what: String) {
+    print((ok ? "PASS  " : "FAIL  ") + what)
+    if !ok { failures += 1 }
+}
+
+func pipeline(_ output: URL, sizes: [Int], workers: Int, force: Bool = false) -> ThumbnailPipeline<StubRenderer> {
+    ThumbnailPipeline(outputFolder: output, sizes: sizes, workers: workers, force: force) { StubRenderer() }
+}
+
+let modelCount = Bench.intArgument(default: 48)
+let fm = FileManager.default
+let root = fm.temporaryDirectory.appendingPathComponent("aquire-thumbs-\(UUID().uuidString)", isDirectory: true)
+let assets = root.appendingPathComponent("assets", isDirectory: true)
+let output = root.appendingPathComponent("out", isDirectory: true)
+try fm.createDirectory(at: assets.appendingPathComponent("nested"), withIntermediateDirectories: true)
+
+for i in 0..<modelCount {
+    let folder = i % 3 == 0 ? assets.appendingPathComponent("nested") : assets
+    try Data(repeating: UInt8(i & 0xFF), count: 64 * 1024).write(to: folder.appendingPathComponent("model\(i).usdz"))
+}
+try Data("ignore me".utf8).write(to: assets.appendingPathComponent("README.txt"))
+
+let models = ThumbnailPipeline<StubRenderer>.findModels(in: assets)
+let workers = max(2, min(8, ProcessInfo.processInfo.activeProcessorCount))
+
+// 1. Cold run: everything renders, every size from one load, across the pool.
+Bench.header("cold run (\(modelCount) models, sizes 128/256/512, \(workers) workers)")
+check(models.count == modelCount, "found \(modelCount) models, ignored non-model files")
+let cold = try pipeline(output, sizes: [512, 128, 256], workers: workers).run(models: models, assetsFolder: assets)
+print(cold.summary)
+check(cold.count(.rendered) == modelCount, "all models rendered")
+check(StubRenderer.log.loads == modelCount, "one load per model for three sizes (got \(StubRenderer.log.loads))")
+check(StubRenderer.log.renderers == workers, "one renderer per worker, reused (got \(StubRenderer.log.renderers))")
+check(StubRenderer.log.peakConcurrent <= workers, "never more than \(workers) renders at once (peak \(StubRenderer.log.peakConcurrent))")
+check(StubRenderer.log.peakConcurrent > 1, "renders overlapped")
+check(fm.fileExists(atPath: output.appendingPathComponent("model1_thumb_128.png").path), "writes <name>_thumb_<size>.png")
+check(fm.fileExists(atPath: output.appendingPathComponent("nested_model0_thumb_128.png").path), "nested models are named by folder too")
+
+// 2. Serial baseline for the same work.
+StubRenderer.log.reset()
+let serial = try pipeline(root.appendingPathComponent("serial"), sizes: [128, 256, 512], workers: 1).run(models: models, assetsFolder: assets)
+print(String(format: "serial %.1f ms vs %d workers %.1f ms (%.1fx)", serial.wallMs, workers, cold.wallMs, serial.wallMs / max(cold.wallMs, 0.001)))
+check(cold.wallMs < serial.wallMs, "worker pool beats serial")
+
+// 3. Warm run: nothing changed, nothing renders.
+Bench.header("incremental runs")
+StubRenderer.log.reset()
+let warm = try pipeline(output, sizes: [128, 256, 512], workers: workers).run(models: models, assetsFolder: assets)
+print(warm.summary)
+check(warm.count(.skipped) == modelCount && StubRenderer.log.loads == 0, "unchanged models all skipped")
+
+// 4. One edited model, one deleted output: only those render, and only what's missing.
+StubRenderer.log.reset()
+try Data(repeating: 0xEE, count: 64 * 1024).write(to: assets.appendingPathComponent("model1.usdz"))
+try fm.removeItem(at: output.appendingPathComponent("model2_thumb_256.png"))
+let edited = try pipeline(output, sizes: [128, 256, 512], workers: workers).run(models: models, assetsFolder: assets)
+let rendered = edited.assets.filter { $0.status == .rendered }
+check(rendered.map(\.asset).sorted() == ["model1.usdz", "model2.usdz"], "edited model and model with a missing output re-rendered (got \(rendered.map(\.asset)))")
+check(rendered.first { $0.asset == "model2.usdz" }?.sizes == [256], "only the missing size re-rendered")
+
+// 5. New size: one load per model for just that size.
+StubRenderer.log.reset()
+let grown = try pipeline(output, sizes: [128, 256, 512, 1024], workers: workers).run(models: models, assetsFolder: assets)
+check(grown.count(.rendered) == modelCount && Set(StubRenderer.log.renderedSizes) == [1024], "adding a size renders only that size")
+
+// 6. Failures are reported, kept out of the manifest, and retried.
+StubRenderer.log.reset()
+try Data("x".utf8).write(to: assets.appendingPathComponent("broken.usdz"))
+let withBroken = ThumbnailPipeline<StubRenderer>.findModels(in: assets)
+let failed = try pipeline(output, sizes: [128, 256, 512, 1024], workers: workers).run(models: withBroken, assetsFolder: assets)
+check(failed.count(.failed) == 1 && failed.assets.first { $0.status == .failed }?.error != nil, "failing model reported with an error")
+let manifest = ThumbnailManifest.load(from: output.appendingPathComponent(ThumbnailManifest.fileName), renderer: StubRenderer.identity)
+check(manifest.entries["broken.usdz"] == nil, "failed model has no manifest entry")
+check(manifest.entries["nested/model0.usdz"] != nil, "manifest keyed by path relative to the assets folder")
+try fm.removeItem(at: assets.appendingPathComponent("broken.usdz"))
+
+// 7. Same basename in different folders or with different extensions.
+Bench.header("colliding names")
+do {
+    let dupeAssets = root.appendingPathComponent("dupes", isDirectory: true)
+    let dupeOutput = root.appendingPathComponent("dupes-out", isDirectory: true)
+    try fm.createDirectory(at: dupeAssets.appendingPathComponent("nested"), withIntermediateDirectories: true)
+    try Data(repeating: 1, count: 1024).write(to: dupeAssets.appendingPathComponent("chair.usdz"))
+    try Data(repeating: 2, count: 1024).write(to: dupeAssets.appendingPathComponent("chair.scn"))
+    try Data(repeating: 3, count: 1024).write(to: dupeAssets.appendingPathComponent("nested/chair.usdz"))
+    try Data(repeating: 4, count: 1024).write(to: dupeAssets.appendingPathComponent("nested_chair.usdz"))
+    let dupeModels = ThumbnailPipeline<StubRenderer>.findModels(in: dupeAssets)
+
+    let first = try pipeline(dupeOutput, sizes: [128], workers: workers).run(models: dupeModels, assetsFolder: dupeAssets)
+    print(first.summary)
+    let failedAssets = first.assets.filter { $0.status == .failed }.map(\.asset).sorted()
+    check(first.count(.rendered) == 2 && failedAssets == ["chair.usdz", "nested_chair.usdz"], "one model per output name renders, the rest fail (failed \(failedAssets))")
+    check(first.assets.filter { $0.status == .failed }.allSatisfy { $0.error?.contains("overwrite") == true }, "collisions are reported as such")
+    check(fm.fileExists(atPath: dupeOutput.appendingPathComponent("chair_thumb_128.png").path)
+          && fm.fileExists(atPath: dupeOutput.appendingPathComponent("nested_chair_thumb_128.png").path), "nested/chair.usdz and chair.scn get distinct files")
+
+    let second = try pipeline(dupeOutput, sizes: [128], workers: workers).run(models: dupeModels, assetsFolder: dupeAssets)
+    check(second.count(.skipped) == 2 && second.count(.failed) == 2, "losers never count the winner's file as theirs")
+}
+
+// 8. Report round-trips as JSON; --force and a renderer change both invalidate everything.
+let reportData = try Data(contentsOf: output.appendingPathComponent(ThumbnailReport.fileName))
+let decoded = try? JSONDecoder().decode(ThumbnailReport.self, from: reportData)
+check(decoded?.assets.count == withBroken.count, "report is machine-readable JSON with one row per asset")
+let forced = try pipeline(output, sizes: [128], workers: workers, force: true).run(models: models, assetsFolder: assets)
+check(forced.count(.rendered) == modelCount, "--force re-renders everything")
+let foreign = ThumbnailManifest.load(from: output.appendingPathComponent(ThumbnailManifest.fileName), renderer: "other-renderer")
+check(foreign.entries.isEmpty, "manifest from another renderer is ignored")
+
+// 9. Hash cost at asset-folder scale.
+Bench.header("hashing")
+let big = Data(repeating: 0x5A, count: 32 * 1024 * 1024)
+let (_, hashMs) = Bench.time { ContentHash.fnv1a64(big) }
+print(String(format: "fnv1a64 over 32 MB: %.1f ms (%.0f MB/s)", hashMs, 32 / (hashMs / 1_000)))
+
+try? fm.removeItem(at: root)
+print("")
+print(failures == 0 ? "all checks passed" : "\(failures) check(s) failed")
+exit(failures == 0 ? 0 : 1)
@@ -0,0 +1,301 @@
+import Foundation
+
+// Headless startup warmup: runs the app's warmup graph (catalog, search index, summary,
+// scene and model caches) through WarmupScheduler with simulated work at each
+// performance tier, and reports time-to-ready for the catalog and the caches. Then checks the
+// scheduler itself: priority order, CPU budget, prerequisites, level skips, interaction cancel,
+// cycles, failures, tasks with nothing to do, cancelling running low-priority work.
+// Usage (from the repo root, Linux or macOS):
+//   swiftc -O Utilities/WarmupScheduler.swift Utilities/WarmupPlan.swift Utilities/LRUCostCache.swift \
+//       Utilities/CacheSupport.swift Utilities/AsyncLRUCache.swift Utilities/SummaryEngine.swift \
+//       Core/Product.swift Core/ProductStore.swift Core/ProductSearch.swift \
+//       tools/bench/BenchSupport.swift tools/bench/SyntheticCatalog.swift \
+//       tools/bench/warmup/main.swift -o /tmp/warmup_bench
+//   /tmp/warmup_bench [sku-count]
+// Exits non-zero if any check fails.
+
+var failures = 0
+
+func check(_ ok: Bool, _ what: String) {
+    print((ok ? "PASS  " : "FAIL  ") + what)
+    if !ok { failures += 1 }
+}
+
+/// Keeps a core busy for `ms`, like decode/parse work would (sleeping wouldn't load the CPU).
+func spin(ms: Double) {
+    let end = Bench.now() + UInt64(ms * 1_000_000)
+    var x = 0
+    while Bench.now() < end {
+        x &+= 1
+    }
+    Bench.sink &+= x
+}
+
+/// Records start order and how much budget is in use at once.
+final class RunLog: @unchecked Sendable {
+    private let lock = NSLock()
+    private(set) var started: [String] = []
+    private(set) var peakCost = 0
+    private var activeCost = 0
+
+    func begin(_ id: String, cost: Int) {
+        lock.lock()
+        started.append(id)
+        activeCost += cost
+        peakCost = max(peakCost, activeCost)
+        lock.unlock()
+    }
+
+    func end(cost: Int) {
+        lock.lock()
+        activeCost -= cost
+        lock.unlock()
+    }
+}
+
+/// Same task with its start/end and cost reported to `log`.
+/// What the scheduler charges is capped at the budget, so the log is too.
+func logged(_ task: WarmupTask, _ log: RunLog, cpu: Int) -> WarmupTask {
+    let (id, cost, work) = (task.id, min(max(task.cost, 1), cpu), task.work)
+    return WarmupTask(id: id, priority: task.priority, cost: task.cost, prerequisites: task.prerequisites, level: task.level) {
+        log.begin(id, cost: cost)
+        defer { log.end(cost: cost) }
+        try await work()
+    }
+}
+
+// MARK: - The app graph, with simulated work
+
+/// StartupWarmup.budget(for:) maps the app's performance tiers onto these levels.
+let tiers: [(name: String, budget: WarmupBudget)] = [
+    ("performance", WarmupPlan.budget(for: .minimal)),
+    ("balanced", WarmupPlan.budget(for: .standard)),
+    ("cinematic", WarmupPlan.budget(for: .full))
+]
+
+let catalogTasks = WarmupPlan.catalogTasks
+let cacheTasks = WarmupPlan.cacheTasks
+
+/// Everything one warmup run produced, so ready state can be checked afterwards.
+final class Warmed: @unchecked Sendable {
+    var store: ProductStore?
+    var index: ProductSearchIndex?
+    let summaries = SummaryEngine(backend: HeuristicSummaryBackend())
+    let scenes = AsyncLRUCache<String, Data>(costLimit: 64 * 1024 * 1024, cost: { $0.count }) { _ in
+        spin(ms: 15)
+        return Data(count: 2 * 1024 * 1024)
+    }
+    let models = AsyncLRUCache<String, Data>(costLimit: 64 * 1024 * 1024, cost: { $0.count }) { _ in
+        spin(ms: 10)
+        return Data(count: 1024 * 1024)
+    }
+}
+
+/// Simulated work for each spec in WarmupPlan, the graph StartupWarmup.tasks(budget:) runs.
+func simulatedWork(_ w: Warmed, records: [CatalogRecord]) -> [String: @Sendable () async throws -> Void] {
+    [
+        WarmupPlan.catalog.id: {
+            w.store = ProductStore(records: records)
+        },
+        WarmupPlan.formatters.id: {
+            _ = 199.0.formatted(FloatingPointFormatStyle<Double>.Currency(code: "USD"))
+        },
+        WarmupPlan.searchIndex.id: {
+            if let store = w.store { w.index = ProductSearchIndex(store: store) }
+        },
+        WarmupPlan.summaries.id: {
+            _ = await w.summaries.summarizeAll(records.map { SummaryRequest(name: $0.name, description: $0.description) }, maxConcurrent: 2)
+        },
+        WarmupPlan.scenes.id: {
+            for key in records.prefix(4).map(\.key) {
+                try Task.checkCancellation()
+                _ = await w.scenes.value(for: key, priority: .background)
+            }
+        },
+        WarmupPlan.models.id: {
+            _ = await w.models.value(for: records[0].key, priority: .background)
+        }
+    ]
+}
+
+/// The app graph with simulated work. A spec without any fails, so a new task can't go unbenched.
+func appTasks(_ w: Warmed, records: [CatalogRecord]) -> [WarmupTask] {
+    let work = simulatedWork(w, records: records)
+    return WarmupPlan.all.map { spec in
+        spec.task(work[spec.id] ?? { throw CancellationError() })
+    }
+}
+
+/// Runs the scheduler off the main thread; `wait()` blocks until the report is in.
+final class PendingRun: @unchecked Sendable {
+    private let done = DispatchSemaphore(value: 0)
+    private var report: WarmupReport?
+
+    init(_ scheduler: WarmupScheduler) {
+        Task {
+            self.report = await scheduler.run()
+            self.done.signal()
+        }
+    }
+
+    func wait() -> WarmupReport {
+        done.wait()
+        return report!
+    }
+}
+
+func run(_ tasks: [WarmupTask], _ budget: WarmupBudget) -> WarmupReport {
+    PendingRun(WarmupScheduler(tasks: tasks, budget: budget)).wait()
+}
+
+func ms(_ value: Double?) -> String {
+    value.map { String(format: "%8.1f ms", $0) } ?? "   not warmed"
+}
+
+let skuCount = Bench.intArgument(default: 20_000)
+let records = SyntheticCatalog.records(count: skuCount)
+
+for tier in tiers {
+    Bench.header("\(tier.name) tier (level \(tier.budget.level), cpu \(tier.budget.cpu), \(skuCount) SKUs)")
+    let warmed = Warmed()
+    let log = RunLog()
+    let report = run(appTasks(warmed, records: records).map { logged($0, log, cpu: tier.budget.cpu) }, tier.budget)
+    print(report.summary)
+    print("catalog ready  " + ms(report.readyMs(catalogTasks)))
+    print("caches ready   " + ms(report.readyMs(cacheTasks)))
+    print(String(format: "total          %8.1f ms", report.totalMs))
+
+    check(report.tasks.allSatisfy { $0.status != .failed }, "\(tier.name): every planned task has simulated work")
+    check(report.timing("catalog")?.status == .finished && warmed.store?.count == skuCount, "\(tier.name): catalog warmed")
+    let catalogStart = report.timing("catalog")?.startMs ?? .infinity
+    check(report.tasks.allSatisfy { ($0.startMs ?? .infinity) >= catalogStart }, "\(tier.name): high-priority catalog starts first")
+    check(log.peakCost <= tier.budget.cpu, "\(tier.name): peak cost \(log.peakCost) within cpu budget \(tier.budget.cpu)")
+    let expectSkipped = appTasks(warmed, records: records).filter { $0.level > tier.budget.level }.map(\.id)
+    check(expectSkipped.allSatisfy { report.timing($0)?.status == .skipped }, "\(tier.name): tasks above the tier are skipped (\(expectSkipped.joined(separator: ", ")))")
+    if tier.budget.level == .full {
+        check(report.readyMs(cacheTasks) != nil, "\(tier.name): caches ready")
+        let scenesEnd = report.timing("scenes")?.endMs ?? .infinity
+        check((report.timing("models")?.startMs ?? 0) >= scenesEnd, "\(tier.name): models waits for scenes")
+    }
+}
+
+// MARK: - Scheduler behaviour
+
+/// A task that just records itself and burns `ms` of CPU.
+func stub(_ id: String, _ priority: WarmupPriority = .normal, cost: Int = 1, after prerequisites: [String] = [],
+          level: WarmupLevel = .minimal, ms: Double = 2, fails: Bool = false, skips: Bool = false) -> WarmupTask {
+    WarmupTask(id: id, priority: priority, cost: cost, prerequisites: prerequisites, level: level) {
+        if skips { throw WarmupSkipped() }
+        spin(ms: ms)
+        if fails { throw CancellationError() }
+    }
+}
+
+Bench.header("ordering and budget")
+do {
+    let log = RunLog()
+    let tasks = [stub("low", .low), stub("normal", .normal), stub("high", .high)].map { logged($0, log, cpu: 1) }
+    _ = run(tasks, WarmupBudget(level: .full, cpu: 1))
+    check(log.started == ["high", "normal", "low"], "cpu 1 runs strictly by priority (\(log.started))")
+}
+do {
+    let log = RunLog()
+    let tasks = (0..<12).map { stub("t\($0)", cost: 1 + $0 % 3, ms: 3) }.map { logged($0, log, cpu: 4) }
+    let report = run(tasks, WarmupBudget(level: .full, cpu: 4))
+    check(log.peakCost <= 4, "mixed costs never exceed cpu 4 (peak \(log.peakCost))")
+    check(log.peakCost > 1, "budget is actually used concurrently")
+    check(report.tasks.allSatisfy { $0.status == .finished }, "all twelve finish")
+}
+do {
+    let report = run([stub("huge", cost: 8), stub("small")], WarmupBudget(level: .full, cpu: 2))
+    let hugeEnd = report.timing("huge")?.endMs ?? .infinity
+    check(report.timing("huge")?.status == .finished && (report.timing("small")?.startMs ?? 0) >= hugeEnd, "a task costlier than the budget still runs, alone")
+}
+
+Bench.header("prerequisites")
+do {
+    let log = RunLog()
+    let tasks = [stub("c", .high, after: ["b"]), stub("b", .high, after: ["a"]), stub("a", .low)].map { logged($0, log, cpu: 4) }
+    let report = run(tasks, WarmupBudget(level: .full, cpu: 4))
+    check(log.started == ["a", "b", "c"], "chain runs in dependency order despite priority (\(log.started))")
+    check((report.timing("b")?.startMs ?? 0) >= (report.timing("a")?.endMs ?? .infinity), "b starts after a ends")
+}
+do {
+    let report = run([
+        stub("base", fails: true),
+        stub("child", after: ["base"]),
+        stub("grandchild", after: ["child"]),
+        stub("independent")
+    ], WarmupBudget(level: .full, cpu: 2))
+    check(report.timing("base")?.status == .failed, "throwing task is failed")
+    check(report.timing("child")?.status == .skipped && report.timing("grandchild")?.status == .skipped, "failure skips dependents transitively")
+    check(report.timing("independent")?.status == .finished, "unrelated work still runs")
+}
+do {
+    let report = run([stub("empty", skips: true), stub("uses_empty", after: ["empty"])], WarmupBudget(level: .full, cpu: 2))
+    check(report.timing("empty")?.status == .skipped, "a task with nothing to warm reports skipped, not finished")
+    check(report.timing("uses_empty")?.status == .skipped, "and its dependents are skipped")
+    check(report.readyMs(["empty"]) == nil, "a skipped cache never counts as ready")
+}
+do {
+    let report = run([
+        stub("x", after: ["y"]),
+        stub("y", after: ["x"]),
+        stub("orphan", after: ["missing"]),
+        stub("heavy", level: .full),
+        stub("after_heavy", after: ["heavy"]),
+        stub("ok")
+    ], WarmupBudget(level: .standard, cpu: 2))
+    check(report.timing("x")?.status == .skipped && report.timing("y")?.status == .skipped, "cycle is skipped, not hung")
+    check(report.timing("orphan")?.status == .skipped, "missing prerequisite is skipped")
+    check(report.timing("heavy")?.status == .skipped && report.timing("after_heavy")?.status == .skipped, "level skip propagates to dependents")
+    check(report.timing("ok")?.status == .finished, "the rest finishes")
+}
+
+Bench.header("user interaction")
+do {
+    let tasks = [stub("first", .high, ms: 30)] + (0..<6).map { stub("later\($0)", .low, ms: 5) }
+    let scheduler = WarmupScheduler(tasks: tasks, budget: WarmupBudget(level: .full, cpu: 1))
+    let pending = PendingRun(scheduler)
+    usleep(10_000)
+    let (_, cancelMs) = Bench.time {
+        let sent = DispatchSemaphore(value: 0)
+        Task {
+            await scheduler.userDidInteract()
+            sent.signal()
+        }
+        sent.wait()
+    }
+    let report = pending.wait()
+    Bench.report("userDidInteract", cancelMs * 1_000_000)
+    check(report.timing("first")?.status == .finished, "running task is allowed to finish")
+    check(report.tasks.dropFirst().allSatisfy { $0.status == .cancelled }, "unstarted tasks are cancelled")
+    check(report.interactionMs != nil && report.totalMs < 60, String(format: "run ends soon after interaction (%.1f ms)", report.totalMs))
+}
+do {
+    // 200 ms of low-priority work in 2 ms steps, checking for cancellation between them.
+    let chunked = WarmupTask(id: "low_running", priority: .low) {
+        for _ in 0..<100 {
+            try Task.checkCancellation()
+            spin(ms: 2)
+        }
+    }
+    let tasks = [chunked, stub("normal_running", .normal, ms: 30)]
+    let scheduler = WarmupScheduler(tasks: tasks, budget: WarmupBudget(level: .full, cpu: 2))
+    let pending = PendingRun(scheduler)
+    usleep(10_000)
+    let sent = DispatchSemaphore(value: 0)
+    Task {
+        await scheduler.userDidInteract()
+        sent.signal()
+    }
+    sent.wait()
+    let report = pending.wait()
+    check(report.timing("low_running")?.status == .cancelled, "running low-priority work is cancelled on interaction")
+    check(report.timing("normal_running")?.status == .finished, "running normal-priority work finishes")
+    check(report.totalMs < 100, String(format: "cancelled work stops at its next check (%.1f ms)", report.totalMs))
+}
+
+print("")
+print(failures == 0 ? "all checks passed" : "\(failures) check(s) failed")
+exit(failures == 0 ? 0 : 1)
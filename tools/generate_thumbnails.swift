@@ -1,94 +1,147 @@
-#!/usr/bin/env swift
 import Foundation
 import SceneKit
 import Metal
 import AppKit
 
-// Simple script to render thumbnails for USDZ/scene files using SceneKit + Metal.
-// Usage: swift tools/generate_thumbnails.swift /path/to/assets /path/to/output [size]
+// Renders thumbnails for USDZ/scene files using SceneKit + Metal, incrementally and in parallel.
+// Unchanged models are skipped via a content-hash manifest in the output folder; each model is
+// loaded once for all sizes; a per-asset timing report is written as thumbnails-report.json.
+// The manifest/scheduling layer is in tools/thumbnails and is tested on Linux (tools/bench/thumbnails).
+// Build (macOS, from the repo root):
+//   swiftc -O Utilities/CacheSupport.swift tools/thumbnails/ThumbnailPipeline.swift \
+//       tools/generate_thumbnails.swift -o /tmp/generate_thumbnails
+// Usage: generate_thumbnails <assets-folder> <output-folder> [sizes] [--jobs N] [--force]
+//   sizes: comma-separated pixel sizes, e.g. 256,512 (default 512)
 
-func usage() -> Never {
-    let exe = URL(fileURLWithPath: CommandLine.arguments[0]).lastPathComponent
-    print("Usage: \(exe) <assets-folder> <output-folder> [size]")
-    exit(1)
-}
+/// One SCNRenderer per worker, reused across models; every size comes from a single scene load.
+final class SceneKitThumbnailRenderer: ThumbnailRendering {
+
+    static let identity = "scenekit-v1-fov45-z3-msaa4x-png"
+
+    enum RenderError: Error, CustomStringConvertible {
+        case load(String)
+        case encode(Int)
 
-guard CommandLine.argc >= 3 else { usage() }
-let assetsFolder = URL(fileURLWithPath: CommandLine.arguments[1], isDirectory: true)
-let outputFolder = URL(fileURLWithPath: CommandLine.arguments[2], isDirectory: true)
-let sizeArg = CommandLine.argc >= 4 ? Int(CommandLine.arguments[3]) ?? 512 : 512
-let size = CGSize(width: sizeArg, height: sizeArg)
-
-let fm = FileManager.default
-if !fm.fileExists(atPath: assetsFolder.path) { print("Assets folder not found: \(assetsFolder.path)"); exit(1) }
-try? fm.createDirectory(at: outputFolder, withIntermediateDirectories: true)
-
-let exts = ["usdz", "scn", "dae"]
-let device = MTLCreateSystemDefaultDevice()
-guard let mtlDevice = device else { print("No Metal device available."); exit(1) }
-
-func findModels(in folder: URL) -> [URL] {
-    let enumerator = fm.enumerator(at: folder, includingPropertiesForKeys: nil)
-    var results: [URL] = []
-    while let f = enumerator?.nextObject() as? URL {
-        if exts.contains(f.pathExtension.lowercased()) {
-            results.append(f)
+        var description: String {
+            switch self {
+            case .load(let path): return "failed to load scene for \(path)"
+            case .encode(let size): return "failed to encode \(size)px PNG"
+            }
+        }
+    }
+
+    private let renderer: SCNRenderer
+
+    init(device: MTLDevice) {
+        renderer = SCNRenderer(device: device, options: nil)
+    }
+
+    func render(modelAt url: URL, sizes: [Int]) throws -> [Int: Data] {
+        try autoreleasepool {
+            guard let scene = (try? SCNScene(url: url, options: nil)) ?? SCNScene(named: url.lastPathComponent) else {
+                throw RenderError.load(url.path)
+            }
+
+            renderer.scene = scene
+            // Use the scene's own camera if it has one, otherwise a default.
+            renderer.pointOfView = scene.rootNode.childNodes { node, _ in node.camera != nil }.first ?? Self.defaultCamera()
+
+            var out: [Int: Data] = [:]
+            for size in sizes {
+                let image = renderer.snapshot(atTime: 0.0, with: CGSize(width: size, height: size), antialiasingMode: .multisampling4X)
+                guard let tiff = image.tiffRepresentation,
+                      let rep = NSBitmapImageRep(data: tiff),
+                      let png = rep.representation(using: .png, properties: [:]) else {
+                    throw RenderError.encode(size)
+                }
+                out[size] = png
+            }
+            renderer.scene = nil
+            return out
         }
     }
-    return results
-}
 
-let models = findModels(in: assetsFolder)
-if models.isEmpty {
-    print("No model files found in \(assetsFolder.path)")
-    exit(0)
+    private static func defaultCamera() -> SCNNode {
+        let cam = SCNNode()
+        cam.camera = SCNCamera()
+        cam.camera?.fieldOfView = 45
+        cam.position = SCNVector3(0, 0, 3)
+        return cam
+    }
 }
 
-print("Found \(models.count) models; rendering thumbnails to \(outputFolder.path)")
-
-for modelURL in models {
-    autoreleasepool {
-        let name = modelURL.deletingPathExtension().lastPathComponent
-        print("Rendering \(name) ...")
-        var scene: SCNScene?
-        if let s = try? SCNScene(url: modelURL, options: nil) {
-            scene = s
-        } else if let s = SCNScene(named: modelURL.lastPathComponent) {
-            scene = s
+@main
+enum GenerateThumbnails {
+
+    static func usage() -> Never {
+        let exe = URL(fileURLWithPath: CommandLine.arguments[0]).lastPathComponent
+        print("Usage: \(exe) <assets-folder> <output-folder> [sizes] [--jobs N] [--force]")
+        exit(1)
+    }
+
+    static func main() {
+        var positional: [String] = []
+        var jobs = ProcessInfo.processInfo.activeProcessorCount
+        var force = false
+
+        var args = CommandLine.arguments.dropFirst()
+        while let arg = args.popFirst() {
+            switch arg {
+            case "--force":
+                force = true
+            case "--jobs":
+                guard let n = args.popFirst().flatMap({ Int($0) }), n > 0 else { usage() }
+                jobs = n
+            default:
+                positional.append(arg)
+            }
+        }
+        guard positional.count >= 2 else { usage() }
+
+        let assetsFolder = URL(fileURLWithPath: positional[0], isDirectory: true)
+        let outputFolder = URL(fileURLWithPath: positional[1], isDirectory: true)
+        let sizes = positional.count >= 3
+            ? positional[2].split(separator: ",").compactMap { Int($0) }
+            : [512]
+        guard !sizes.isEmpty else { usage() }
+
+        if !FileManager.default.fileExists(atPath: assetsFolder.path) {
+            print("Assets folder not found: \(assetsFolder.path)")
+            exit(1)
+        }
+        guard let device = MTLCreateSystemDefaultDevice() else {
+            print("No Metal device available.")
+            exit(1)
         }
 
-        guard let sceneUnwrapped = scene else {
-            print("  Failed to load scene for \(modelURL.path)")
-            return
+        let pipeline = ThumbnailPipeline(outputFolder: outputFolder, sizes: sizes, workers: jobs, force: force) {
+            SceneKitThumbnailRenderer(device: device)
         }
+        let models = ThumbnailPipeline<SceneKitThumbnailRenderer>.findModels(in: assetsFolder)
+        if models.isEmpty {
+            print("No model files found in \(assetsFolder.path)")
+            exit(0)
+        }
+
+        print("Found \(models.count) models; rendering \(pipeline.sizes.map(String.init).joined(separator: ",")) px thumbnails to \(outputFolder.path)")
 
-        // Create a renderer and snapshot
-        let renderer = SCNRenderer(device: mtlDevice, options: nil)
-        renderer.scene = sceneUnwrapped
-
-        // Provide a default camera if scene doesn't have one
-        if renderer.pointOfView == nil {
-            let cam = SCNNode()
-            cam.camera = SCNCamera()
-            cam.camera?.fieldOfView = 45
-            cam.position = SCNVector3(0, 0, 3)
-            renderer.pointOfView = cam
+        let report: ThumbnailReport
+        do {
+            report = try pipeline.run(models: models, assetsFolder: assetsFolder)
+        } catch {
+            print("Failed: \(error)")
+            exit(1)
         }
 
-        // snapshot
-        let nsImage = renderer.snapshot(atTime: 0.0, with: size, antialiasingMode: .multisampling4X)
-
-        // Write PNG
-        if let tiff = nsImage.tiffRepresentation,
-           let rep = NSBitmapImageRep(data: tiff),
-           let png = rep.representation(using: .png, properties: [:]) {
-            let outURL = outputFolder.appendingPathComponent("\(name)_thumb.png")
-            try? png.write(to: outURL)
-            print("  -> \(outURL.path)")
-        } else {
-            print("  Failed to write thumbnail for \(name)")
+        for asset in report.assets where asset.status != .skipped {
+            if let error = asset.error {
+                print("  \(asset.asset): \(error)")
+            } else {
+                print(String(format: "  %@ -> %@ px in %.1f ms", asset.asset, asset.sizes.map(String.init).joined(separator: ","), asset.totalMs))
+            }
         }
+        print(report.summary)
+        print("Report: \(pipeline.reportURL.path)")
+        exit(report.count(.failed) == 0 ? 0 : 1)
     }
 }
-
-print("Done.")
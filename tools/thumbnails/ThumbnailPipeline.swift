@@ -0,0 +1,321 @@
+import Foundation
+
+/// Renders one model at several square sizes from a single load.
+/// The pipeline makes one renderer per worker and reuses it for every model that worker takes,
+/// so implementations can hold on to expensive state (device, renderer, command queue).
+protocol ThumbnailRendering {
+    /// Changes whenever the same input would render differently (camera, lighting, encoder).
+    /// Stored in the manifest; a different identity re-renders everything.
+    static var identity: String { get }
+
+    /// PNG data for each of `sizes` (pixels per side).
+    func render(modelAt url: URL, sizes: [Int]) throws -> [Int: Data]
+}
+
+enum ThumbnailError: Error, CustomStringConvertible {
+    case unreadable(URL)
+    case missingSize(Int)
+    /// Another model already writes the same output files.
+    case duplicateOutput(String, String)
+
+    var description: String {
+        switch self {
+        case .unreadable(let url): return "cannot read \(url.lastPathComponent)"
+        case .missingSize(let size): return "renderer produced no \(size)px image"
+        case .duplicateOutput(let asset, let owner): return "\(asset) would overwrite the thumbnails of \(owner)"
+        }
+    }
+}
+
+// MARK: - Manifest
+
+/// What was last rendered for each model: its content hash and the sizes written from it.
+/// A model is skipped when its hash matches and every requested size is still on disk.
+struct ThumbnailManifest: Codable, Equatable {
+
+    static let fileName = "thumbnails-manifest.json"
+    static let currentVersion = 1
+
+    struct Entry: Codable, Equatable {
+        /// FNV-1a 64 of the model file, hex.
+        var contentHash: String
+        var sizes: [Int]
+    }
+
+    var version = currentVersion
+    var renderer: String
+    /// Keyed by the model's path relative to the assets folder.
+    var entries: [String: Entry] = [:]
+
+    /// Empty manifest if the file is missing, unreadable, from another format version,
+    /// or was written by a different renderer.
+    static func load(from url: URL, renderer: String) -> ThumbnailManifest {
+        guard let data = try? Data(contentsOf: url),
+              let manifest = try? JSONDecoder().decode(ThumbnailManifest.self, from: data),
+              manifest.version == currentVersion,
+              manifest.renderer == renderer else {
+            return ThumbnailManifest(renderer: renderer)
+        }
+        return manifest
+    }
+
+    /// Sorted, pretty-printed JSON so the manifest diffs cleanly if it's checked in.
+    func save(to url: URL) throws {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        try encoder.encode(self).write(to: url, options: .atomic)
+    }
+}
+
+// MARK: - Report
+
+/// Per-asset outcome and timings. Written as JSON next to the manifest.
+struct AssetTiming: Codable, Equatable {
+    enum Status: String, Codable {
+        case rendered
+        case skipped
+        case failed
+    }
+
+    var asset: String
+    var status: Status
+    /// Sizes rendered on this run (empty when skipped).
+    var sizes: [Int] = []
+    var inputBytes = 0
+    var outputBytes = 0
+    var hashMs = 0.0
+    var renderMs = 0.0
+    var writeMs = 0.0
+    var totalMs = 0.0
+    var error: String?
+}
+
+struct ThumbnailReport: Codable {
+    static let fileName = "thumbnails-report.json"
+
+    var renderer: String
+    var workers: Int
+    var sizes: [Int]
+    var wallMs: Double
+    /// In input order.
+    var assets: [AssetTiming]
+
+    func count(_ status: AssetTiming.Status) -> Int {
+        assets.reduce(0) { $0 + ($1.status == status ? 1 : 0) }
+    }
+
+    var summary: String {
+        String(format: "%d rendered, %d skipped, %d failed in %.1f ms (%d workers)",
+               count(.rendered), count(.skipped), count(.failed), wallMs, workers)
+    }
+
+    func write(to url: URL) throws {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        try encoder.encode(self).write(to: url, options: .atomic)
+    }
+}
+
+// MARK: - Pipeline
+
+/// Incremental, parallel thumbnail build:
+/// hash each model → skip it if the manifest says its outputs are current → otherwise load it
+/// once and render every missing size. A fixed pool of workers pulls models off a shared index,
+/// so at most `workers` models are in memory at once. Renderer-agnostic; see generate_thumbnails.
+final class ThumbnailPipeline<Renderer: ThumbnailRendering> {
+
+    static var modelExtensions: Set<String> { ["usdz", "scn", "dae"] }
+
+    let outputFolder: URL
+    let sizes: [Int]
+    let workers: Int
+    /// Ignore the manifest and re-render everything.
+    let force: Bool
+
+    private let makeRenderer: () -> Renderer
+    private let fm = FileManager.default
+
+    init(
+        outputFolder: URL,
+        sizes: [Int],
+        workers: Int = ProcessInfo.processInfo.activeProcessorCount,
+        force: Bool = false,
+        makeRenderer: @escaping () -> Renderer
+    ) {
+        self.outputFolder = outputFolder
+        self.sizes = Array(Set(sizes.filter { $0 > 0 })).sorted()
+        self.workers = max(workers, 1)
+        self.force = force
+        self.makeRenderer = makeRenderer
+    }
+
+    var manifestURL: URL { outputFolder.appendingPathComponent(ThumbnailManifest.fileName) }
+    var reportURL: URL { outputFolder.appendingPathComponent(ThumbnailReport.fileName) }
+
+    static func outputName(forModel name: String, size: Int) -> String {
+        "\(name)_thumb_\(size).png"
+    }
+
+    /// Output name stem for a model at `key` (path relative to the assets folder): the path
+    /// without its extension, folders joined by "_". Top-level "chair.usdz" stays "chair";
+    /// "a/chair.usdz" becomes "a_chair".
+    static func outputStem(forKey key: String) -> String {
+        let path = key as NSString
+        return path.deletingPathExtension.replacingOccurrences(of: "/", with: "_")
+    }
+
+    /// Model files under `folder`, sorted by path so runs are deterministic.
+    static func findModels(in folder: URL) -> [URL] {
+        let enumerator = FileManager.default.enumerator(at: folder, includingPropertiesForKeys: nil)
+        var results: [URL] = []
+        while let f = enumerator?.nextObject() as? URL {
+            if modelExtensions.contains(f.pathExtension.lowercased()) {
+                results.append(f)
+            }
+        }
+        return results.sorted { $0.path < $1.path }
+    }
+
+    /// Renders whatever is out of date among `models`, then rewrites the manifest and report.
+    /// Manifest entries for models that are gone are dropped; failed models get no entry so
+    /// the next run retries them.
+    @discardableResult
+    func run(models: [URL], assetsFolder: URL) throws -> ThumbnailReport {
+        let start = DispatchTime.now().uptimeNanoseconds
+        try fm.createDirectory(at: outputFolder, withIntermediateDirectories: true)
+
+        let previous = force
+            ? ThumbnailManifest(renderer: Renderer.identity)
+            : ThumbnailManifest.load(from: manifestURL, renderer: Renderer.identity)
+        let keys = models.map { Self.relativePath(of: $0, in: assetsFolder) }
+        let stems = keys.map(Self.outputStem(forKey:))
+
+        // Two models with one stem ("chair.usdz" + "chair.scn", "a_chair.usdz" + "a/chair.usdz")
+        // would write the same files from different workers. The first in path order keeps the
+        // name; the others fail without touching disk.
+        var owners: [String: String] = [:]
+        var duplicateOf = [String?](repeating: nil, count: models.count)
+        for i in models.indices {
+            if let owner = owners[stems[i]] {
+                duplicateOf[i] = owner
+            } else {
+                owners[stems[i]] = keys[i]
+            }
+        }
+
+        let lock = NSLock()
+        var nextIndex = 0
+        var timings = [AssetTiming?](repeating: nil, count: models.count)
+        var entries = [ThumbnailManifest.Entry?](repeating: nil, count: models.count)
+
+        let poolSize = min(workers, models.count)
+        DispatchQueue.concurrentPerform(iterations: poolSize) { _ in
+            let renderer = makeRenderer()
+            while true {
+                lock.lock()
+                let i = nextIndex
+                nextIndex += 1
+                lock.unlock()
+                guard i < models.count else { return }
+
+                let begin = DispatchTime.now().uptimeNanoseconds
+                let result: (timing: AssetTiming, entry: ThumbnailManifest.Entry?)
+                if let owner = duplicateOf[i] {
+                    let error = ThumbnailError.duplicateOutput(keys[i], owner)
+                    result = (AssetTiming(asset: keys[i], status: .failed, error: error.description), nil)
+                } else {
+                    result = process(models[i], key: keys[i], stem: stems[i], previous: previous.entries[keys[i]], renderer: renderer)
+                }
+                var timing = result.timing
+                timing.totalMs = Self.ms(since: begin)
+                lock.lock()
+                timings[i] = timing
+                entries[i] = result.entry
+                lock.unlock()
+            }
+        }
+
+        var manifest = ThumbnailManifest(renderer: Renderer.identity)
+        for (key, entry) in zip(keys, entries) {
+            manifest.entries[key] = entry
+        }
+        try manifest.save(to: manifestURL)
+
+        let report = ThumbnailReport(
+            renderer: Renderer.identity,
+            workers: poolSize,
+            sizes: sizes,
+            wallMs: Self.ms(since: start),
+            assets: timings.compactMap { $0 }
+        )
+        try report.write(to: reportURL)
+        return report
+    }
+
+    // MARK: - Per model
+
+    private func process(
+        _ model: URL,
+        key: String,
+        stem name: String,
+        previous: ThumbnailManifest.Entry?,
+        renderer: Renderer
+    ) -> (timing: AssetTiming, entry: ThumbnailManifest.Entry?) {
+        let start = DispatchTime.now().uptimeNanoseconds
+        var timing = AssetTiming(asset: key, status: .failed)
+
+        guard let data = try? Data(contentsOf: model, options: .alwaysMapped) else {
+            timing.error = ThumbnailError.unreadable(model).description
+            return (timing, nil)
+        }
+        timing.inputBytes = data.count
+        let hash = String(ContentHash.fnv1a64(data), radix: 16)
+        timing.hashMs = Self.ms(since: start)
+
+        // Sizes already rendered from these exact bytes and still on disk.
+        let current = previous?.contentHash == hash ? Set(previous?.sizes ?? []) : []
+        let present = current.filter { fm.fileExists(atPath: outputURL(name, $0).path) }
+        let missing = sizes.filter { !present.contains($0) }
+
+        guard !missing.isEmpty else {
+            timing.status = .skipped
+            return (timing, ThumbnailManifest.Entry(contentHash: hash, sizes: present.sorted()))
+        }
+
+        do {
+            let renderStart = DispatchTime.now().uptimeNanoseconds
+            let images = try renderer.render(modelAt: model, sizes: missing)
+            timing.renderMs = Self.ms(since: renderStart)
+
+            let writeStart = DispatchTime.now().uptimeNanoseconds
+            for size in missing {
+                guard let png = images[size] else { throw ThumbnailError.missingSize(size) }
+                try png.write(to: outputURL(name, size), options: .atomic)
+                timing.outputBytes += png.count
+            }
+            timing.writeMs = Self.ms(since: writeStart)
+        } catch {
+            timing.error = "\(error)"
+            return (timing, nil)
+        }
+
+        timing.status = .rendered
+        timing.sizes = missing
+        return (timing, ThumbnailManifest.Entry(contentHash: hash, sizes: present.union(missing).sorted()))
+    }
+
+    private func outputURL(_ name: String, _ size: Int) -> URL {
+        outputFolder.appendingPathComponent(Self.outputName(forModel: name, size: size))
+    }
+
+    private static func relativePath(of url: URL, in folder: URL) -> String {
+        let base = folder.resolvingSymlinksInPath().path
+        let path = url.resolvingSymlinksInPath().path
+        guard path.hasPrefix(base) else { return url.lastPathComponent }
+        return String(path.dropFirst(base.count).drop { $0 == "/" })
+    }
+
+    private static func ms(since start: UInt64) -> Double {
+        Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000
+    }
+}